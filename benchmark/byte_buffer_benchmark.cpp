@@ -0,0 +1,813 @@
+#include <array>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "../include/byte_buffer/async_io.hpp"
+#include "../include/byte_buffer/buffer_cursor.hpp"
+#include "../include/byte_buffer/buffer_log.hpp"
+#include "../include/byte_buffer/buffer_pool.hpp"
+#include "../include/byte_buffer/byte_queue.hpp"
+#include "../include/byte_buffer/direct_io.hpp"
+#include "../include/byte_buffer/byte_buffer.hpp"
+#include "../include/byte_buffer/kernels.hpp"
+#include "../include/byte_buffer/memory_resource.hpp"
+#include "../include/byte_buffer/parallel.hpp"
+
+namespace
+{
+std::atomic<int64_t> allocationCount{};
+
+void* countedAllocate(std::size_t size, std::size_t alignment)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	// aligned_alloc requires the size to be a multiple of the alignment
+	const auto alignedSize{(std::max<std::size_t>(size, 1) + alignment - 1) / alignment * alignment};
+
+	if (const auto p{std::aligned_alloc(alignment, alignedSize)})
+	{
+		return p;
+	}
+
+	throw std::bad_alloc();
+}
+
+// reports the average number of heap allocations per benchmark iteration
+class AllocationCounter final
+{
+public:
+	explicit AllocationCounter(benchmark::State& state) : state_{state}, start_{allocationCount.load()} {}
+
+	~AllocationCounter()
+	{
+		state_.counters["allocations"] = benchmark::Counter(allocationCount.load() - start_, benchmark::Counter::kAvgIterations);
+	}
+
+private:
+	benchmark::State& state_;
+	int64_t start_;
+};
+
+constexpr auto benchmarkFileName{"byte_buffer_bench_file"};
+
+void createBenchmarkFile(std::size_t size)
+{
+	const std::vector<char> data(size, 'x');
+	std::ofstream file(benchmarkFileName);
+	file.write(data.data(), data.size());
+}
+
+void construct(benchmark::State& state)
+{
+	const std::vector<std::byte> bytes(state.range(0));
+	const AllocationCounter allocationCounter(state);
+
+	for (auto _ : state)
+	{
+		const byte_buffer::Buffer buffer(bytes);
+		benchmark::DoNotOptimize(buffer.data().data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+void construct_pooled(benchmark::State& state)
+{
+	const std::vector<std::byte> bytes(state.range(0));
+	auto& pool{byte_buffer::thread_buffer_pool()};
+	const AllocationCounter allocationCounter(state);
+
+	for (auto _ : state)
+	{
+		auto buffer{pool.acquire(bytes.size())};
+		buffer->append(bytes);
+		benchmark::DoNotOptimize(buffer->data().data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * bytes.size());
+	pool.trim();
+}
+
+void copy_construct(benchmark::State& state)
+{
+	const byte_buffer::Buffer source(std::vector<std::byte>(state.range(0)));
+	const AllocationCounter allocationCounter(state);
+
+	for (auto _ : state)
+	{
+		const byte_buffer::Buffer buffer(source);
+		benchmark::DoNotOptimize(buffer.data().data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * source.size());
+}
+
+void move_construct(benchmark::State& state)
+{
+	byte_buffer::Buffer source(std::vector<std::byte>(state.range(0)));
+	const AllocationCounter allocationCounter(state);
+
+	for (auto _ : state)
+	{
+		byte_buffer::Buffer buffer(std::move(source));
+		benchmark::DoNotOptimize(buffer.data().data());
+		source = std::move(buffer);
+	}
+}
+
+void overwrite(benchmark::State& state)
+{
+	const std::vector<std::byte> bytes(state.range(0));
+	byte_buffer::Buffer buffer;
+	const AllocationCounter allocationCounter(state);
+
+	for (auto _ : state)
+	{
+		buffer.overwrite(bytes);
+		benchmark::DoNotOptimize(buffer.data().data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * bytes.size());
+}
+
+void append(benchmark::State& state)
+{
+	const std::vector<std::byte> bytes(state.range(0));
+	const AllocationCounter allocationCounter(state);
+
+	for (auto _ : state)
+	{
+		byte_buffer::Buffer buffer;
+		buffer.append(bytes);
+		buffer.append(bytes);
+		benchmark::DoNotOptimize(buffer.data().data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * 2 * bytes.size());
+}
+
+void append_loop(benchmark::State& state, byte_buffer::GrowthPolicy growthPolicy)
+{
+	const std::vector<std::byte> chunk(16);
+	const auto appendCount{state.range(0)};
+	const AllocationCounter allocationCounter(state);
+
+	for (auto _ : state)
+	{
+		byte_buffer::Buffer buffer(growthPolicy);
+
+		for (auto i{0}; i < appendCount; ++i)
+		{
+			buffer.append(chunk);
+		}
+
+		benchmark::DoNotOptimize(buffer.data().data());
+	}
+
+	state.SetComplexityN(appendCount);
+	state.SetItemsProcessed(state.iterations() * appendCount);
+}
+
+void read_file_ifstream(benchmark::State& state)
+{
+	const auto size{static_cast<byte_buffer::BufferSize>(state.range(0))};
+	createBenchmarkFile(size);
+	byte_buffer::Buffer buffer;
+
+	for (auto _ : state)
+	{
+		std::ifstream file(benchmarkFileName);
+		buffer.overwrite(file, size);
+		benchmark::DoNotOptimize(buffer.data().data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * size);
+	std::filesystem::remove(benchmarkFileName);
+}
+
+void read_file_fd(benchmark::State& state)
+{
+	const auto size{static_cast<byte_buffer::BufferSize>(state.range(0))};
+	createBenchmarkFile(size);
+	byte_buffer::Buffer buffer;
+
+	for (auto _ : state)
+	{
+		const auto fd{::open(benchmarkFileName, O_RDONLY)};
+		buffer.clear();
+		buffer.read_from(fd, size);
+		::close(fd);
+		benchmark::DoNotOptimize(buffer.data().data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * size);
+	std::filesystem::remove(benchmarkFileName);
+}
+
+void read_file_direct(benchmark::State& state)
+{
+	const auto size{static_cast<byte_buffer::BufferSize>(state.range(0))};
+	createBenchmarkFile(size);
+	byte_buffer::Buffer buffer;
+
+	for (auto _ : state)
+	{
+		buffer.clear();
+		byte_buffer::DirectReader reader(benchmarkFileName);
+		reader.append_to(buffer);
+		benchmark::DoNotOptimize(buffer.data().data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * size);
+	std::filesystem::remove(benchmarkFileName);
+}
+
+// checksums the file chunk by chunk, the next chunk is read while the current one is processed
+void scan_file_direct(benchmark::State& state)
+{
+	const auto size{static_cast<byte_buffer::BufferSize>(state.range(0))};
+	createBenchmarkFile(size);
+
+	for (auto _ : state)
+	{
+		byte_buffer::DirectReader reader(benchmarkFileName);
+		uint32_t crc{};
+
+		for (auto chunk{reader.next()}; !chunk.empty(); chunk = reader.next())
+		{
+			crc = byte_buffer::kernels::crc32c(chunk, crc);
+		}
+
+		benchmark::DoNotOptimize(crc);
+	}
+
+	state.SetBytesProcessed(state.iterations() * size);
+	std::filesystem::remove(benchmarkFileName);
+}
+
+constexpr byte_buffer::BufferSize streamSize{1 << 20};
+constexpr std::size_t streamChunkSize{16 << 10};
+
+std::vector<std::array<int, 2>> openPipes(std::size_t count, int readFlags)
+{
+	std::vector<std::array<int, 2>> pipes(count);
+
+	for (auto& fds : pipes)
+	{
+		if (::pipe2(fds.data(), O_CLOEXEC) == -1)
+		{
+			std::abort();
+		}
+
+		::fcntl(fds[0], F_SETFL, ::fcntl(fds[0], F_GETFL) | readFlags);
+	}
+
+	return pipes;
+}
+
+// feeds the streams round robin, so every stream receives data while the others are drained
+void feedStreams(const std::vector<std::array<int, 2>>& pipes)
+{
+	const std::vector<std::byte> chunk(streamChunkSize, std::byte{0x5});
+
+	for (std::size_t offset{}; offset < streamSize; offset += streamChunkSize)
+	{
+		for (const auto& fds : pipes)
+		{
+			for (std::size_t bytesWritten{}; bytesWritten < chunk.size();)
+			{
+				bytesWritten += std::max<ssize_t>(::write(fds[1], chunk.data() + bytesWritten, chunk.size() - bytesWritten), 0);
+			}
+		}
+	}
+
+	for (const auto& fds : pipes)
+	{
+		::close(fds[1]);
+	}
+}
+
+byte_buffer::Task<> readStream(byte_buffer::Buffer& buffer, int fd)
+{
+	co_await buffer.async_append(fd, streamSize);
+}
+
+// drains the streams with coroutines on a single thread
+void pipe_streams_async(benchmark::State& state)
+{
+	const auto streamCount{static_cast<std::size_t>(state.range(0))};
+	std::vector<byte_buffer::Buffer> buffers(streamCount);
+	auto& loop{byte_buffer::thread_event_loop()};
+
+	for (auto _ : state)
+	{
+		const auto pipes{openPipes(streamCount, O_NONBLOCK)};
+		std::thread writer(feedStreams, std::cref(pipes));
+
+		for (std::size_t i{}; i < streamCount; ++i)
+		{
+			buffers[i].clear();
+			loop.spawn(readStream(buffers[i], pipes[i][0]));
+		}
+
+		loop.run();
+		writer.join();
+
+		for (const auto& fds : pipes)
+		{
+			::close(fds[0]);
+		}
+	}
+
+	state.SetBytesProcessed(state.iterations() * streamCount * streamSize);
+}
+
+// drains the streams with a blocking reader thread per stream
+void pipe_streams_threads(benchmark::State& state)
+{
+	const auto streamCount{static_cast<std::size_t>(state.range(0))};
+	std::vector<byte_buffer::Buffer> buffers(streamCount);
+
+	for (auto _ : state)
+	{
+		const auto pipes{openPipes(streamCount, 0)};
+		std::thread writer(feedStreams, std::cref(pipes));
+		std::vector<std::thread> readers;
+
+		for (std::size_t i{}; i < streamCount; ++i)
+		{
+			buffers[i].clear();
+			readers.emplace_back([&buffer = buffers[i], fd = pipes[i][0]] { buffer.read_from(fd, streamSize); });
+		}
+
+		for (auto& reader : readers)
+		{
+			reader.join();
+		}
+
+		writer.join();
+
+		for (const auto& fds : pipes)
+		{
+			::close(fds[0]);
+		}
+	}
+
+	state.SetBytesProcessed(state.iterations() * streamCount * streamSize);
+}
+
+constexpr std::size_t parallelSize{256 << 20};
+
+// copies a payload much larger than the cache, the thread count is the benchmark argument
+void parallel_copy(benchmark::State& state, bool nonTemporal)
+{
+	byte_buffer::ThreadPool pool(state.range(0));
+	const std::vector<std::byte> source(parallelSize, std::byte{0x1});
+	std::vector<std::byte> destination(parallelSize);
+
+	for (auto _ : state)
+	{
+		pool.copy(destination, source, nonTemporal);
+		benchmark::DoNotOptimize(destination.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * parallelSize);
+}
+
+void parallel_fill(benchmark::State& state, bool nonTemporal)
+{
+	byte_buffer::ThreadPool pool(state.range(0));
+	std::vector<std::byte> destination(parallelSize);
+
+	for (auto _ : state)
+	{
+		pool.fill(destination, std::byte{0x2}, nonTemporal);
+		benchmark::DoNotOptimize(destination.data());
+	}
+
+	state.SetBytesProcessed(state.iterations() * parallelSize);
+}
+
+void parallel_crc32c(benchmark::State& state)
+{
+	byte_buffer::ThreadPool pool(state.range(0));
+	const std::vector<std::byte> data(parallelSize, std::byte{0x3});
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(pool.crc32c(data));
+	}
+
+	state.SetBytesProcessed(state.iterations() * parallelSize);
+}
+
+// copy constructs a buffer, the copies reaching the threshold go through the default thread pool
+void copy_construct_parallel(benchmark::State& state)
+{
+	const byte_buffer::Buffer buffer(std::vector<std::byte>(state.range(0)));
+	byte_buffer::set_parallel_copy_policy({16 << 20, false});
+
+	for (auto _ : state)
+	{
+		byte_buffer::Buffer copy(buffer);
+		benchmark::DoNotOptimize(copy.data().data());
+	}
+
+	byte_buffer::set_parallel_copy_policy({});
+	state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+constexpr std::size_t logRecordSize{256};
+constexpr auto logFileName{"byte_buffer_bench_log"};
+
+// appends records and makes every group durable with one sync, the group size is the benchmark argument
+void log_group_commit(benchmark::State& state)
+{
+	const auto groupSize{state.range(0)};
+	const std::vector<std::byte> record(logRecordSize, std::byte{0x4});
+	std::filesystem::remove(logFileName);
+
+	{
+		byte_buffer::BufferLog log(logFileName);
+
+		for (auto _ : state)
+		{
+			for (auto i{0}; i < groupSize; ++i)
+			{
+				log.append(record);
+			}
+
+			log.sync();
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * groupSize);
+	std::filesystem::remove(logFileName);
+}
+
+// length-prefixed records written with a system call and a copy each, the group is made durable with fdatasync
+void log_group_commit_ofstream(benchmark::State& state)
+{
+	const auto groupSize{state.range(0)};
+	const std::vector<std::byte> record(logRecordSize, std::byte{0x4});
+	const auto size{static_cast<uint32_t>(record.size())};
+
+	{
+		std::ofstream file(logFileName, std::ios::binary);
+		const auto fd{::open(logFileName, O_WRONLY)};
+
+		for (auto _ : state)
+		{
+			for (auto i{0}; i < groupSize; ++i)
+			{
+				file.write(reinterpret_cast<const char*>(&size), sizeof(size));
+				file.write(reinterpret_cast<const char*>(record.data()), record.size());
+				file.flush();
+			}
+
+			::fdatasync(fd);
+		}
+
+		::close(fd);
+	}
+
+	state.SetItemsProcessed(state.iterations() * groupSize);
+	std::filesystem::remove(logFileName);
+}
+
+struct Message
+{
+	uint32_t id;
+	uint64_t timestamp;
+	uint16_t flags;
+	double value;
+};
+
+void serialize_append(benchmark::State& state)
+{
+	constexpr Message message{42, 1700000000, 3, 2.5};
+	const auto messageCount{state.range(0)};
+	byte_buffer::Buffer buffer(byte_buffer::GrowthPolicy::geometric_2);
+
+	for (auto _ : state)
+	{
+		buffer.clear();
+
+		for (auto i{0}; i < messageCount; ++i)
+		{
+			std::byte field[sizeof(uint64_t)];
+			std::memcpy(field, &message.id, sizeof(message.id));
+			buffer.append({field, sizeof(message.id)});
+			std::memcpy(field, &message.timestamp, sizeof(message.timestamp));
+			buffer.append({field, sizeof(message.timestamp)});
+			std::memcpy(field, &message.flags, sizeof(message.flags));
+			buffer.append({field, sizeof(message.flags)});
+			std::memcpy(field, &message.value, sizeof(message.value));
+			buffer.append({field, sizeof(message.value)});
+		}
+
+		benchmark::DoNotOptimize(buffer.data().data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * messageCount);
+}
+
+void serialize_writer(benchmark::State& state)
+{
+	constexpr Message message{42, 1700000000, 3, 2.5};
+	const auto messageCount{state.range(0)};
+	byte_buffer::Buffer buffer(byte_buffer::GrowthPolicy::geometric_2);
+
+	for (auto _ : state)
+	{
+		buffer.clear();
+		byte_buffer::BufferWriter writer(buffer);
+
+		for (auto i{0}; i < messageCount; ++i)
+		{
+			writer.reserve(sizeof(Message));
+			writer.write(message.id);
+			writer.write(message.timestamp);
+			writer.write(message.flags);
+			writer.write(message.value);
+		}
+
+		writer.flush();
+		benchmark::DoNotOptimize(buffer.data().data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * messageCount);
+}
+
+void find_byte(benchmark::State& state, std::size_t (*kernel)(std::span<const std::byte>, std::byte) noexcept)
+{
+	std::vector<std::byte> data(state.range(0));
+	data.back() = std::byte{0x1};
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(kernel(data, std::byte{0x1}));
+	}
+
+	state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void crc32c(benchmark::State& state, uint32_t (*kernel)(std::span<const std::byte>, uint32_t) noexcept)
+{
+	const std::vector<std::byte> data(state.range(0));
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(kernel(data, 0));
+	}
+
+	state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+void hash64(benchmark::State& state)
+{
+	const std::vector<std::byte> data(state.range(0));
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(byte_buffer::kernels::hash64(data));
+	}
+
+	state.SetBytesProcessed(state.iterations() * data.size());
+}
+
+// scans a large buffer allocated with the given alignment and page backing, the first touch is not measured
+void sequential_scan(benchmark::State& state, std::size_t alignment, std::optional<byte_buffer::HugePages> hugePages)
+{
+	std::optional<byte_buffer::PageResource> resource;
+
+	if (hugePages)
+	{
+		resource.emplace(byte_buffer::PageOptions{.hugePages = *hugePages});
+	}
+
+	byte_buffer::Buffer buffer(resource ? &*resource : std::pmr::get_default_resource());
+	buffer.set_alignment(alignment);
+
+	const auto window{buffer.prepare(state.range(0))};
+	std::memset(window.data(), 0, window.size());
+	buffer.commit(window.size());
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(byte_buffer::kernels::find(buffer.data(), std::byte{0x1}));
+	}
+
+	state.SetBytesProcessed(state.iterations() * buffer.size());
+}
+
+constexpr std::size_t queueMessageCount{1 << 14};
+
+template<typename Queue>
+void queue_throughput(benchmark::State& state)
+{
+	Queue queue{1 << 20};
+	const std::vector<std::byte> message(state.range(0));
+
+	for (auto _ : state)
+	{
+		std::jthread producer{[&queue, &message] {
+			for (std::size_t i{}; i < queueMessageCount;)
+			{
+				if (queue.try_push(message))
+				{
+					++i;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		}};
+
+		for (std::size_t consumed{}; consumed < queueMessageCount;)
+		{
+			const auto count{queue.consume([](std::span<const std::byte> bytes) { benchmark::DoNotOptimize(bytes.data()); })};
+
+			if (!count)
+			{
+				std::this_thread::yield();
+			}
+
+			consumed += count;
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * queueMessageCount);
+	state.SetBytesProcessed(state.iterations() * queueMessageCount * message.size());
+}
+
+// baseline for the lock-free queues: one allocated buffer per message behind a mutex
+void queue_throughput_mutex(benchmark::State& state)
+{
+	std::mutex mutex;
+	std::queue<byte_buffer::Buffer> queue;
+	const std::vector<std::byte> message(state.range(0));
+
+	for (auto _ : state)
+	{
+		std::jthread producer{[&mutex, &queue, &message] {
+			for (std::size_t i{}; i < queueMessageCount; ++i)
+			{
+				byte_buffer::Buffer buffer{message};
+				const std::lock_guard lock{mutex};
+				queue.push(std::move(buffer));
+			}
+		}};
+
+		for (std::size_t consumed{}; consumed < queueMessageCount;)
+		{
+			std::unique_lock lock{mutex};
+
+			if (queue.empty())
+			{
+				lock.unlock();
+				std::this_thread::yield();
+				continue;
+			}
+
+			const auto buffer{std::move(queue.front())};
+			queue.pop();
+			lock.unlock();
+			benchmark::DoNotOptimize(buffer.data());
+			++consumed;
+		}
+	}
+
+	state.SetItemsProcessed(state.iterations() * queueMessageCount);
+	state.SetBytesProcessed(state.iterations() * queueMessageCount * message.size());
+}
+
+// 8 B up to 1 GiB
+void dataSizes(benchmark::internal::Benchmark* benchmark)
+{
+	benchmark->RangeMultiplier(8)->Range(8, 1 << 30);
+}
+
+// 4 KiB up to 1 GiB
+void fileSizes(benchmark::internal::Benchmark* benchmark)
+{
+	benchmark->RangeMultiplier(16)->Range(4 << 10, 1 << 30);
+}
+
+// 16 MiB up to 1 GiB
+void scanSizes(benchmark::internal::Benchmark* benchmark)
+{
+	benchmark->RangeMultiplier(4)->Range(16 << 20, 1 << 30);
+}
+
+// 1 thread doubling up to the number of hardware threads
+void threadCounts(benchmark::internal::Benchmark* benchmark)
+{
+	const auto maxThreads{std::max(std::thread::hardware_concurrency(), 1u)};
+
+	for (auto threads{1u}; threads < maxThreads; threads *= 2)
+	{
+		benchmark->Arg(threads);
+	}
+
+	benchmark->Arg(maxThreads)->UseRealTime();
+}
+
+void appendCounts(benchmark::internal::Benchmark* benchmark)
+{
+	benchmark->RangeMultiplier(4)->Range(16, 16 << 10)->Complexity();
+}
+} // namespace
+
+void* operator new(std::size_t size)
+{
+	return countedAllocate(size, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+	return countedAllocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept
+{
+	std::free(p);
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t) noexcept
+{
+	std::free(p);
+}
+
+BENCHMARK(construct)->Apply(dataSizes);
+BENCHMARK(construct_pooled)->Apply(dataSizes);
+BENCHMARK(copy_construct)->Apply(dataSizes);
+BENCHMARK(move_construct)->Apply(dataSizes);
+BENCHMARK(overwrite)->Apply(dataSizes);
+BENCHMARK(append)->Apply(dataSizes);
+
+BENCHMARK_CAPTURE(append_loop, exact, byte_buffer::GrowthPolicy::exact)->Apply(appendCounts);
+BENCHMARK_CAPTURE(append_loop, geometric_1_5, byte_buffer::GrowthPolicy::geometric_1_5)->Apply(appendCounts);
+BENCHMARK_CAPTURE(append_loop, geometric_2, byte_buffer::GrowthPolicy::geometric_2)->Apply(appendCounts);
+BENCHMARK_CAPTURE(append_loop, page_rounded, byte_buffer::GrowthPolicy::page_rounded)->Apply(appendCounts);
+BENCHMARK_CAPTURE(append_loop, fixed_chunk, byte_buffer::GrowthPolicy::fixed_chunk)->Apply(appendCounts);
+
+BENCHMARK(serialize_append)->RangeMultiplier(16)->Range(1, 64 << 10);
+BENCHMARK(serialize_writer)->RangeMultiplier(16)->Range(1, 64 << 10);
+
+BENCHMARK_CAPTURE(find_byte, dispatched, byte_buffer::kernels::find)->RangeMultiplier(64)->Range(64, 16 << 20);
+BENCHMARK_CAPTURE(find_byte, scalar, byte_buffer::kernels::scalar::find)->RangeMultiplier(64)->Range(64, 16 << 20);
+BENCHMARK_CAPTURE(crc32c, dispatched, byte_buffer::kernels::crc32c)->RangeMultiplier(64)->Range(64, 16 << 20);
+BENCHMARK_CAPTURE(crc32c, scalar, byte_buffer::kernels::scalar::crc32c)->RangeMultiplier(64)->Range(64, 16 << 20);
+BENCHMARK(hash64)->RangeMultiplier(64)->Range(64, 16 << 20);
+
+BENCHMARK_CAPTURE(sequential_scan, default, byte_buffer::Buffer::defaultAlignment, std::nullopt)->Apply(scanSizes);
+BENCHMARK_CAPTURE(sequential_scan, aligned_64, 64, std::nullopt)->Apply(scanSizes);
+BENCHMARK_CAPTURE(sequential_scan, pages_4k, 4096, byte_buffer::HugePages::none)->Apply(scanSizes);
+BENCHMARK_CAPTURE(sequential_scan, transparent_huge_pages, 2 << 20, byte_buffer::HugePages::transparent)->Apply(scanSizes);
+
+BENCHMARK_TEMPLATE(queue_throughput, byte_buffer::SpscByteQueue)->RangeMultiplier(8)->Range(8, 4 << 10)->UseRealTime();
+BENCHMARK_TEMPLATE(queue_throughput, byte_buffer::MpscByteQueue)->RangeMultiplier(8)->Range(8, 4 << 10)->UseRealTime();
+BENCHMARK(queue_throughput_mutex)->RangeMultiplier(8)->Range(8, 4 << 10)->UseRealTime();
+
+BENCHMARK(read_file_ifstream)->Apply(fileSizes);
+BENCHMARK(read_file_fd)->Apply(fileSizes);
+BENCHMARK(read_file_direct)->Apply(fileSizes);
+BENCHMARK(scan_file_direct)->Apply(fileSizes)->UseRealTime();
+
+BENCHMARK(pipe_streams_async)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+BENCHMARK(pipe_streams_threads)->RangeMultiplier(4)->Range(1, 64)->UseRealTime();
+
+BENCHMARK_CAPTURE(parallel_copy, cached, false)->Apply(threadCounts);
+BENCHMARK_CAPTURE(parallel_copy, non_temporal, true)->Apply(threadCounts);
+BENCHMARK_CAPTURE(parallel_fill, cached, false)->Apply(threadCounts);
+BENCHMARK_CAPTURE(parallel_fill, non_temporal, true)->Apply(threadCounts);
+BENCHMARK(parallel_crc32c)->Apply(threadCounts);
+BENCHMARK(log_group_commit)->RangeMultiplier(8)->Range(1, 4 << 10)->UseRealTime();
+BENCHMARK(log_group_commit_ofstream)->RangeMultiplier(8)->Range(1, 4 << 10)->UseRealTime();
+BENCHMARK(copy_construct_parallel)->RangeMultiplier(8)->Range(1 << 20, 1 << 30)->UseRealTime();
+
+BENCHMARK_MAIN();
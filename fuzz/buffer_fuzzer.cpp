@@ -0,0 +1,22 @@
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "buffer_model.hpp"
+
+// libFuzzer entry point, AFL++ runs the same target when built with `afl-clang-fast++ -fsanitize=fuzzer`
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, std::size_t size)
+{
+	try
+	{
+		byte_buffer::fuzz::BufferModel().run({data, size});
+	}
+	catch (const byte_buffer::fuzz::ModelMismatch& error)
+	{
+		std::fprintf(stderr, "buffer differs from its model: %s\n", error.what());
+		std::abort();
+	}
+
+	return 0;
+}
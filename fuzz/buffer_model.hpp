@@ -0,0 +1,403 @@
+#ifndef FUZZ_BUFFER_MODEL_HPP
+#define FUZZ_BUFFER_MODEL_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory_resource>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../include/byte_buffer/byte_buffer.hpp"
+
+namespace byte_buffer::fuzz
+{
+/**
+ * @brief Thrown when a buffer disagrees with its model.
+ */
+class ModelMismatch final : public std::logic_error
+{
+public:
+	using std::logic_error::logic_error;
+};
+
+/**
+ * @brief Reads operation arguments from the fuzzer input, an exhausted input reads as zeros.
+ */
+class InputReader final
+{
+public:
+	explicit InputReader(std::span<const uint8_t> input) noexcept : input_{input} {}
+
+	[[nodiscard]] bool empty() const noexcept
+	{
+		return input_.empty();
+	}
+
+	template <typename T>
+	[[nodiscard]] T read() noexcept
+	{
+		T value{};
+		const auto size{std::min(sizeof(T), input_.size())};
+		std::memcpy(&value, input_.data(), size);
+		input_ = input_.subspan(size);
+
+		return value;
+	}
+
+	// small sizes are the common case, every eighth size is an edge value of the size arithmetic
+	[[nodiscard]] BufferSize size(BufferSize currentSize) noexcept
+	{
+		constexpr auto maxSize{std::numeric_limits<BufferSize>::max()};
+		const auto selector{read<uint8_t>()};
+
+		if (selector % 8)
+		{
+			return read<uint16_t>() % 2048;
+		}
+
+		switch (selector / 8 % 4)
+		{
+			case 0:
+				return maxSize;
+			case 1:
+				return maxSize - currentSize;
+			case 2:
+				return maxSize - currentSize + 1;
+			default:
+				return maxSize / 2 + 1;
+		}
+	}
+
+private:
+	std::span<const uint8_t> input_;
+};
+
+/**
+ * @brief Memory resource refusing large allocations and checking that every deallocation matches its allocation.
+ */
+class CheckedResource final : public std::pmr::memory_resource
+{
+public:
+	static constexpr std::size_t maxAllocationSize{1 << 20};
+
+	CheckedResource() = default;
+	CheckedResource(const CheckedResource&) = delete;
+	CheckedResource& operator=(const CheckedResource&) = delete;
+
+	~CheckedResource() override
+	{
+		for (const auto& [pointer, allocation] : allocations_)
+		{
+			std::pmr::new_delete_resource()->deallocate(pointer, allocation.first, allocation.second);
+		}
+	}
+
+	[[nodiscard]] std::size_t live_allocations() const noexcept
+	{
+		return allocations_.size();
+	}
+
+private:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		// edge sizes would otherwise trip the sanitizer allocation limits before the buffer can handle the failure
+		if (bytes > maxAllocationSize)
+		{
+			throw std::bad_alloc();
+		}
+
+		const auto pointer{std::pmr::new_delete_resource()->allocate(bytes, alignment)};
+		allocations_.emplace(pointer, std::pair{bytes, alignment});
+
+		return pointer;
+	}
+
+	void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override
+	{
+		const auto allocation{allocations_.find(pointer)};
+
+		if (allocation == allocations_.end() || allocation->second != std::pair{bytes, alignment})
+		{
+			throw ModelMismatch("deallocation does not match an allocation");
+		}
+
+		allocations_.erase(allocation);
+		std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+	{
+		return this == &other;
+	}
+
+	std::map<void*, std::pair<std::size_t, std::size_t>> allocations_;
+};
+
+/**
+ * @brief Runs the operations encoded in the input on two buffers and compares them with `std::vector` models.
+ * 
+ * Operations failing with `std::length_error` or `std::bad_alloc` must leave the buffer unchanged.
+ */
+class BufferModel final
+{
+public:
+	BufferModel() : buffers_{Buffer(&resource_), Buffer(&resource_)} {}
+
+	/**
+	 * @brief Runs the operations.
+	 * 
+	 * @param input Encoded operations
+	 * @throws ModelMismatch If a buffer disagrees with its model
+	 */
+	void run(std::span<const uint8_t> input)
+	{
+		InputReader reader(input);
+
+		for (std::size_t step{}; !reader.empty(); ++step)
+		{
+			const auto opcode{reader.read<uint8_t>()};
+			const auto target{opcode & 1u};
+
+			try
+			{
+				runOperation(opcode >> 1, buffers_[target], models_[target], buffers_[target ^ 1], models_[target ^ 1], reader);
+			}
+			catch (const ModelMismatch& error)
+			{
+				throw ModelMismatch("step " + std::to_string(step) + ", operation " + std::to_string(opcode >> 1) + ": " + error.what());
+			}
+		}
+
+		for (auto& buffer : buffers_)
+		{
+			buffer = Buffer(&resource_);
+		}
+
+		check(resource_.live_allocations() == 0, "storage leaked");
+	}
+
+private:
+	static void check(bool condition, const char* what)
+	{
+		if (!condition)
+		{
+			throw ModelMismatch(what);
+		}
+	}
+
+	static void compare(const Buffer& buffer, const std::vector<std::byte>& model)
+	{
+		check(buffer.size() == model.size(), "size differs");
+		check(std::ranges::equal(buffer.data(), model), "data differs");
+		check(buffer.size() <= buffer.capacity(), "size exceeds capacity");
+		check(buffer.empty() == model.empty(), "empty differs");
+		check(reinterpret_cast<uintptr_t>(buffer.data().data()) % buffer.alignment() == 0, "storage is misaligned");
+	}
+
+	static std::vector<std::byte> pattern(std::size_t size, uint8_t seed)
+	{
+		std::vector<std::byte> bytes(size);
+
+		for (std::size_t i{}; i < size; ++i)
+		{
+			bytes[i] = std::byte(seed + i * 31);
+		}
+
+		return bytes;
+	}
+
+	// a failing operation must keep the data and the storage
+	template <typename Operation>
+	static void expectUnchangedOnFailure(Buffer& buffer, const std::vector<std::byte>& model, Operation&& operation)
+	{
+		const auto capacity{buffer.capacity()};
+
+		try
+		{
+			operation();
+		}
+		catch (const std::length_error&)
+		{
+			check(buffer.capacity() == capacity, "failed operation changed the capacity");
+			compare(buffer, model);
+			throw;
+		}
+		catch (const std::bad_alloc&)
+		{
+			check(buffer.capacity() == capacity, "failed allocation changed the capacity");
+			compare(buffer, model);
+			throw;
+		}
+	}
+
+	void runOperation(unsigned operation, Buffer& buffer, std::vector<std::byte>& model, Buffer& other, std::vector<std::byte>& otherModel, InputReader& reader)
+	{
+		try
+		{
+			switch (operation % 18)
+			{
+				case 0:
+				{
+					const auto bytes{pattern(reader.read<uint16_t>() % 2048, reader.read<uint8_t>())};
+					expectUnchangedOnFailure(buffer, model, [&] { buffer.append(bytes); });
+					model.insert(model.end(), bytes.begin(), bytes.end());
+					break;
+				}
+				case 1:
+				{
+					// appends a part of the buffer data to itself
+					const auto offset{model.empty() ? 0 : reader.read<uint16_t>() % model.size()};
+					const auto size{model.empty() ? 0 : reader.read<uint16_t>() % (model.size() - offset + 1)};
+					expectUnchangedOnFailure(buffer, model, [&] { buffer.append(buffer.data().subspan(offset, size)); });
+					model.insert(model.end(), model.begin() + offset, model.begin() + offset + size);
+					break;
+				}
+				case 2:
+				{
+					const auto bytes{pattern(reader.read<uint16_t>() % 2048, reader.read<uint8_t>())};
+					expectUnchangedOnFailure(buffer, model, [&] { buffer.overwrite(bytes); });
+					model = bytes;
+					break;
+				}
+				case 3:
+				{
+					// overwrites the data with a part of itself
+					const auto offset{model.empty() ? 0 : reader.read<uint16_t>() % model.size()};
+					const auto size{model.empty() ? 0 : reader.read<uint16_t>() % (model.size() - offset + 1)};
+					buffer.overwrite(buffer.data().subspan(offset, size));
+					model = std::vector(model.begin() + offset, model.begin() + offset + size);
+					break;
+				}
+				case 4:
+				{
+					const auto capacity{reader.size(buffer.size())};
+					expectUnchangedOnFailure(buffer, model, [&] { buffer.reserve(capacity); });
+					check(buffer.capacity() >= capacity, "reserve did not provide the capacity");
+					break;
+				}
+				case 5:
+					buffer.clear();
+					model.clear();
+					break;
+				case 6:
+				{
+					const auto size{reader.size(buffer.size())};
+					std::span<std::byte> window;
+					expectUnchangedOnFailure(buffer, model, [&] { window = buffer.prepare(size); });
+					check(window.size() == size && buffer.capacity() - buffer.size() >= size, "prepare did not provide the window");
+
+					const auto written{std::min<BufferSize>(size, reader.read<uint16_t>() % 2048)};
+					const auto bytes{pattern(written, reader.read<uint8_t>())};
+					std::ranges::copy(bytes, window.begin());
+					buffer.commit(written);
+					model.insert(model.end(), bytes.begin(), bytes.end());
+					break;
+				}
+				case 7:
+				{
+					const auto freeSpace{buffer.capacity() - buffer.size()};
+
+					if (freeSpace < std::numeric_limits<BufferSize>::max())
+					{
+						try
+						{
+							buffer.commit(freeSpace + 1);
+							check(false, "commit beyond the free space succeeded");
+						}
+						catch (const std::out_of_range&)
+						{
+						}
+					}
+
+					break;
+				}
+				case 8:
+				{
+					const BufferSize size(reader.read<uint16_t>() % 2048);
+					buffer.resize_uninitialized(size);
+
+					// the added bytes are indeterminate, the model takes them from the buffer
+					const auto keptSize{std::min<std::size_t>(model.size(), size)};
+					model.resize(size);
+					std::copy(buffer.data().begin() + keptSize, buffer.data().end(), model.begin() + keptSize);
+					break;
+				}
+				case 9:
+					buffer.shrink_to_fit();
+					check(buffer.capacity() == buffer.size() || buffer.capacity() <= Buffer::inlineCapacity, "shrink kept excess capacity");
+					break;
+				case 10:
+					buffer.set_growth_policy(static_cast<GrowthPolicy>(reader.read<uint8_t>() % 5));
+					break;
+				case 11:
+					buffer.set_trim_policy({static_cast<uint8_t>(reader.read<uint8_t>() % 101), static_cast<uint8_t>(reader.read<uint8_t>() % 4)});
+					break;
+				case 12:
+					buffer.set_alignment(std::size_t{1} << (reader.read<uint8_t>() % 13));
+					break;
+				case 13:
+					buffer = std::move(other);
+					model = std::exchange(otherModel, {});
+					compare(other, otherModel);
+					break;
+				case 14:
+				{
+					Buffer moved(std::move(buffer));
+					compare(buffer, {});
+					compare(moved, model);
+					buffer = std::move(moved);
+					break;
+				}
+				case 15:
+					buffer = other;
+					model = otherModel;
+					break;
+				case 16:
+				{
+					const auto storage{buffer.release()};
+					check(storage.size == model.size() && std::ranges::equal(std::span(storage.data, storage.size), model), "released data differs");
+					check(buffer.capacity() == 0, "released buffer kept its capacity");
+
+					if (storage.data)
+					{
+						storage.resource->deallocate(storage.data, storage.capacity, storage.alignment);
+					}
+
+					model.clear();
+					break;
+				}
+				default:
+				{
+					const Buffer copy(buffer);
+					compare(copy, model);
+					break;
+				}
+			}
+		}
+		catch (const std::length_error&)
+		{
+		}
+		catch (const std::bad_alloc&)
+		{
+		}
+
+		compare(buffer, model);
+		compare(other, otherModel);
+	}
+
+	CheckedResource resource_;
+	std::array<Buffer, 2> buffers_;
+	std::array<std::vector<std::byte>, 2> models_;
+};
+} // namespace byte_buffer::fuzz
+
+#endif // FUZZ_BUFFER_MODEL_HPP
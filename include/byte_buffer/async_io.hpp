@@ -0,0 +1,301 @@
+#ifndef INCLUDE_BYTE_BUFFER_ASYNC_IO_HPP
+#define INCLUDE_BYTE_BUFFER_ASYNC_IO_HPP
+
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include "byte_buffer.hpp"
+
+namespace byte_buffer
+{
+class EventLoop;
+
+namespace detail
+{
+struct TaskPromiseBase
+{
+	struct FinalAwaiter
+	{
+		bool await_ready() const noexcept
+		{
+			return false;
+		}
+
+		template <typename Promise>
+		std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+		{
+			const auto continuation{handle.promise().continuation};
+			return continuation ? continuation : std::noop_coroutine();
+		}
+
+		void await_resume() const noexcept {}
+	};
+
+	std::suspend_always initial_suspend() const noexcept
+	{
+		return {};
+	}
+
+	FinalAwaiter final_suspend() const noexcept
+	{
+		return {};
+	}
+
+	void unhandled_exception() noexcept
+	{
+		exception = std::current_exception();
+	}
+
+	std::coroutine_handle<> continuation;
+	std::exception_ptr exception;
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase
+{
+	void return_value(T result)
+	{
+		value.emplace(std::move(result));
+	}
+
+	T result()
+	{
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+
+		return std::move(*value);
+	}
+
+	std::optional<T> value;
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase
+{
+	void return_void() const noexcept {}
+
+	void result() const
+	{
+		if (exception)
+		{
+			std::rethrow_exception(exception);
+		}
+	}
+};
+
+/**
+ * @brief Non-blocking I/O step resumed by the event loop whenever its file descriptor becomes ready.
+ */
+class IoOperation
+{
+public:
+	IoOperation(EventLoop& loop, int fd, uint32_t events) noexcept;
+
+	IoOperation(const IoOperation&) = delete;
+	IoOperation& operator=(const IoOperation&) = delete;
+
+	/**
+	 * @brief Transfers as much as possible without blocking.
+	 * 
+	 * @return `True` if the operation is complete or failed, `false` if it has to wait for readiness
+	 */
+	virtual bool perform() noexcept = 0;
+
+	bool await_ready() noexcept;
+	bool await_suspend(std::coroutine_handle<> continuation) noexcept;
+
+protected:
+	~IoOperation() = default;
+
+	bool fail(int error, const char* call) noexcept;
+	void throwIfFailed() const;
+
+	int fd_;
+
+private:
+	friend class byte_buffer::EventLoop;
+
+	EventLoop& loop_;
+	uint32_t events_;
+	int error_;
+	const char* failedCall_;
+	std::coroutine_handle<> continuation_;
+};
+} // namespace detail
+
+/**
+ * @brief Lazily started coroutine producing a value, started by `co_await` or `EventLoop::spawn`.
+ * 
+ * @tparam T Result type
+ */
+template <typename T = void>
+class Task final
+{
+public:
+	struct promise_type : detail::TaskPromise<T>
+	{
+		Task get_return_object() noexcept
+		{
+			return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+		}
+	};
+
+	Task(Task&& obj) noexcept : handle_{std::exchange(obj.handle_, {})} {}
+
+	Task& operator=(Task&& obj) noexcept
+	{
+		if (this != &obj)
+		{
+			if (handle_)
+			{
+				handle_.destroy();
+			}
+
+			handle_ = std::exchange(obj.handle_, {});
+		}
+
+		return *this;
+	}
+
+	~Task()
+	{
+		if (handle_)
+		{
+			handle_.destroy();
+		}
+	}
+
+	bool await_ready() const noexcept
+	{
+		return false;
+	}
+
+	std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+	{
+		handle_.promise().continuation = continuation;
+		return handle_;
+	}
+
+	T await_resume()
+	{
+		return handle_.promise().result();
+	}
+
+private:
+	explicit Task(std::coroutine_handle<promise_type> handle) noexcept : handle_{handle} {}
+
+	std::coroutine_handle<promise_type> handle_;
+};
+
+/**
+ * @brief Single-threaded epoll executor of coroutines performing buffer I/O.
+ * 
+ * Pipes and sockets must be in non-blocking mode and have at most one pending operation each. Regular files
+ * are always ready for epoll, so their operations complete without suspending.
+ */
+class EventLoop final
+{
+public:
+	/**
+	 * @brief Creates an event loop.
+	 * 
+	 * @throws std::system_error If the epoll instance cannot be created
+	 */
+	EventLoop();
+
+	EventLoop(const EventLoop&) = delete;
+	EventLoop& operator=(const EventLoop&) = delete;
+
+	~EventLoop();
+
+	/**
+	 * @brief Starts a task, which runs until its first suspension and is completed by `run`.
+	 * 
+	 * @param task Task
+	 */
+	void spawn(Task<void> task);
+
+	/**
+	 * @brief Resumes the suspended operations as their file descriptors become ready until all spawned tasks complete.
+	 * 
+	 * @throws std::system_error If waiting for events fails
+	 * @throws Exception thrown by the first failed task
+	 */
+	void run();
+
+private:
+	friend class detail::IoOperation;
+
+	struct Detached;
+
+	static Detached runDetached(EventLoop& loop, Task<void> task);
+
+	[[nodiscard]] bool wait(detail::IoOperation& operation) noexcept;
+
+	int epollFd_;
+	std::size_t pendingTasks_;
+	std::size_t waitingOperations_;
+	std::exception_ptr exception_;
+};
+
+/**
+ * @brief Returns the event loop `Buffer::async_append` and `Buffer::async_write` wait on.
+ * 
+ * @return Loop spawning or running tasks on the calling thread, otherwise the thread-local default loop
+ */
+[[nodiscard]] EventLoop& thread_event_loop();
+
+/**
+ * @brief Awaitable returned by `Buffer::async_append`, resumes with the number of bytes read.
+ */
+class AppendOperation final : public detail::IoOperation
+{
+public:
+	AppendOperation(EventLoop& loop, Buffer& buffer, int fd, BufferSize size) noexcept;
+
+	bool perform() noexcept override;
+
+	/**
+	 * @brief Returns the result of the operation.
+	 * 
+	 * @return Number of bytes read
+	 * @throws std::system_error If reading fails
+	 */
+	BufferSize await_resume() const;
+
+private:
+	Buffer& buffer_;
+	BufferSize size_;
+	BufferSize bytesRead_;
+};
+
+/**
+ * @brief Awaitable returned by `Buffer::async_write`.
+ */
+class WriteOperation final : public detail::IoOperation
+{
+public:
+	WriteOperation(EventLoop& loop, const Buffer& buffer, int fd) noexcept;
+
+	bool perform() noexcept override;
+
+	/**
+	 * @brief Checks the result of the operation.
+	 * 
+	 * @throws std::system_error If writing fails
+	 */
+	void await_resume() const;
+
+private:
+	const Buffer& buffer_;
+	BufferSize bytesWritten_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_ASYNC_IO_HPP
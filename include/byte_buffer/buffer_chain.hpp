@@ -0,0 +1,90 @@
+#ifndef INCLUDE_BYTE_BUFFER_BUFFER_CHAIN_HPP
+#define INCLUDE_BYTE_BUFFER_BUFFER_CHAIN_HPP
+
+#include <deque>
+#include <sys/uio.h>
+#include <vector>
+
+#include "byte_buffer.hpp"
+
+namespace byte_buffer
+{
+/**
+ * @brief Sequence of buffer segments forming one logical message without copying them together.
+ */
+class BufferChain final
+{
+public:
+	/**
+	 * @brief Adds a segment to the end of the chain.
+	 * 
+	 * @param segment Segment
+	 */
+	void append(Buffer&& segment);
+
+	/**
+	 * @brief Adds a segment to the beginning of the chain.
+	 * 
+	 * @param segment Segment
+	 */
+	void prepend(Buffer&& segment);
+
+	/**
+	 * @brief Returns the chain segments.
+	 * 
+	 * @return Segments
+	 */
+	[[nodiscard]] const std::deque<Buffer>& segments() const noexcept;
+
+	/**
+	 * @brief Returns the chain data as io vectors for `writev`/`sendmsg`.
+	 * 
+	 * The vectors are valid until the chain is modified.
+	 * 
+	 * @return Io vectors, one per non-empty segment
+	 */
+	[[nodiscard]] std::vector<iovec> iovecs() const;
+
+	/**
+	 * @brief Writes the chain data to file descriptor with vectored writes.
+	 * 
+	 * @param fd File descriptor
+	 * @throws std::system_error If writing fails
+	 */
+	void write_to(int fd) const;
+
+	/**
+	 * @brief Merges the segments into a single one.
+	 * 
+	 * The data is copied only if the chain has more than one segment. The chain is unchanged if merging fails.
+	 * 
+	 * @return Segment holding the whole chain data
+	 */
+	const Buffer& flatten();
+
+	/**
+	 * @brief Returns the total size of the chain data.
+	 * 
+	 * @return Chain data size
+	 */
+	[[nodiscard]] BufferSize size() const noexcept;
+
+	/**
+	 * @brief Checks if the chain has no data.
+	 * 
+	 * @return `True` if the chain is empty, otherwise `false`
+	 */
+	[[nodiscard]] bool empty() const noexcept;
+
+	/**
+	 * @brief Removes all segments from the chain.
+	 */
+	void clear() noexcept;
+
+private:
+	std::deque<Buffer> segments_;
+	BufferSize size_{};
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_BUFFER_CHAIN_HPP
@@ -0,0 +1,404 @@
+#ifndef INCLUDE_BYTE_BUFFER_BUFFER_CURSOR_HPP
+#define INCLUDE_BYTE_BUFFER_BUFFER_CURSOR_HPP
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string_view>
+
+#include "byte_buffer.hpp"
+
+namespace byte_buffer
+{
+/**
+ * @brief Fixed-width value that can be written and read by buffer cursors.
+ */
+template <typename T>
+concept Scalar = (std::integral<T> && !std::same_as<T, bool>) || std::same_as<T, float> || std::same_as<T, double>;
+
+namespace detail
+{
+template <std::unsigned_integral T>
+constexpr T byteswap(T value) noexcept
+{
+	T result{};
+
+	for (std::size_t i{}; i < sizeof(T); ++i)
+	{
+		result = static_cast<T>((result << 8) | ((value >> (i * 8)) & 0xff));
+	}
+
+	return result;
+}
+
+template <std::size_t Size>
+struct UnsignedOfSize;
+
+template <>
+struct UnsignedOfSize<1>
+{
+	using Type = uint8_t;
+};
+
+template <>
+struct UnsignedOfSize<2>
+{
+	using Type = uint16_t;
+};
+
+template <>
+struct UnsignedOfSize<4>
+{
+	using Type = uint32_t;
+};
+
+template <>
+struct UnsignedOfSize<8>
+{
+	using Type = uint64_t;
+};
+
+// converts a value between the native byte order and `Endian`
+template <std::endian Endian, Scalar T>
+constexpr auto toUnsigned(T value) noexcept
+{
+	using Unsigned = typename UnsignedOfSize<sizeof(T)>::Type;
+	const auto bits{std::bit_cast<Unsigned>(value)};
+
+	return Endian == std::endian::native ? bits : byteswap(bits);
+}
+
+template <std::endian Endian, Scalar T>
+constexpr T fromUnsigned(typename UnsignedOfSize<sizeof(T)>::Type bits) noexcept
+{
+	return std::bit_cast<T>(Endian == std::endian::native ? bits : byteswap(bits));
+}
+
+constexpr std::size_t maxVarintSize{10};
+} // namespace detail
+
+/**
+ * @brief Serializes values straight into the free space of a buffer.
+ * 
+ * Written bytes are appended to the buffer data by `flush`, which is called when the writer needs more room and on destruction.
+ * The buffer must not be modified while the writer is alive. Call `flush` before destruction to get the error
+ * if it was, the destructor drops the bytes that cannot be committed.
+ * 
+ * @tparam Endian Byte order of the written fixed-width values
+ */
+template <std::endian Endian = std::endian::little>
+class BufferWriter final
+{
+public:
+	explicit BufferWriter(Buffer& buffer) noexcept : buffer_{buffer}, window_{}, written_{} {}
+	BufferWriter(const BufferWriter&) = delete;
+	BufferWriter& operator=(const BufferWriter&) = delete;
+
+	~BufferWriter()
+	{
+		try
+		{
+			flush();
+		}
+		catch (const std::out_of_range&)
+		{
+		}
+	}
+
+	/**
+	 * @brief Makes room for at least `size` more bytes, so that the following writes need no reallocation.
+	 * 
+	 * @param size Number of bytes
+	 * @throws std::length_error If the buffer would exceed the maximum size
+	 */
+	void reserve(BufferSize size)
+	{
+		if (window_.size() - written_ < size)
+		{
+			// the window at least doubles, so field by field writes reallocate only logarithmically often
+			const auto windowSize{std::max<std::size_t>(size, 2 * window_.size())};
+
+			if (windowSize > std::numeric_limits<BufferSize>::max())
+			{
+				throw std::length_error("byte buffer size exceeds the maximum size");
+			}
+
+			flush();
+
+			const auto window{buffer_.prepare(static_cast<BufferSize>(windowSize))};
+			window_ = std::span<std::byte>(window.data(), buffer_.capacity() - buffer_.size());
+		}
+	}
+
+	/**
+	 * @brief Writes a fixed-width value.
+	 * 
+	 * @param value Value
+	 */
+	template <Scalar T>
+	void write(T value)
+	{
+		reserve(sizeof(T));
+
+		const auto bits{detail::toUnsigned<Endian>(value)};
+		std::memcpy(window_.data() + written_, &bits, sizeof(T));
+		written_ += sizeof(T);
+	}
+
+	/**
+	 * @brief Writes an unsigned integer as LEB128 varint.
+	 * 
+	 * @param value Value
+	 */
+	void write_varint(uint64_t value)
+	{
+		reserve(detail::maxVarintSize);
+
+		while (value >= 0x80)
+		{
+			window_[written_++] = std::byte(value | 0x80);
+			value >>= 7;
+		}
+
+		window_[written_++] = std::byte(value);
+	}
+
+	/**
+	 * @brief Writes a signed integer as signed LEB128 varint.
+	 * 
+	 * @param value Value
+	 */
+	void write_signed_varint(int64_t value)
+	{
+		reserve(detail::maxVarintSize);
+
+		for (;;)
+		{
+			const auto byte{static_cast<uint8_t>(value & 0x7f)};
+			value >>= 7;
+
+			if ((value == 0 && !(byte & 0x40)) || (value == -1 && (byte & 0x40)))
+			{
+				window_[written_++] = std::byte(byte);
+				break;
+			}
+
+			window_[written_++] = std::byte(byte | 0x80);
+		}
+	}
+
+	/**
+	 * @brief Writes raw bytes.
+	 * 
+	 * @param bytes Bytes
+	 */
+	void write_bytes(std::span<const std::byte> bytes)
+	{
+		reserve(bytes.size());
+
+		if (!bytes.empty())
+		{
+			std::memcpy(window_.data() + written_, bytes.data(), bytes.size());
+			written_ += bytes.size();
+		}
+	}
+
+	/**
+	 * @brief Writes a string prefixed with its length as varint.
+	 * 
+	 * @param string String
+	 */
+	void write_string(std::string_view string)
+	{
+		reserve(detail::maxVarintSize + string.size());
+		write_varint(string.size());
+		write_bytes(std::as_bytes(std::span{string}));
+	}
+
+	/**
+	 * @brief Appends the written bytes to the buffer data.
+	 * 
+	 * @throws std::out_of_range If the buffer was modified since the writer made room for the bytes
+	 */
+	void flush()
+	{
+		buffer_.commit(written_);
+		window_ = {};
+		written_ = 0;
+	}
+
+private:
+	Buffer& buffer_;
+	std::span<std::byte> window_;
+	BufferSize written_;
+};
+
+/**
+ * @brief Deserializes values from buffer data.
+ * 
+ * @tparam Endian Byte order of the read fixed-width values
+ */
+template <std::endian Endian = std::endian::little>
+class BufferReader final
+{
+public:
+	explicit BufferReader(std::span<const std::byte> data) noexcept : data_{data}, position_{} {}
+
+	/**
+	 * @brief Reads a fixed-width value.
+	 * 
+	 * @return Value
+	 * @throws std::out_of_range If not enough data is left
+	 */
+	template <Scalar T>
+	[[nodiscard]] T read()
+	{
+		typename detail::UnsignedOfSize<sizeof(T)>::Type bits;
+		std::memcpy(&bits, take(sizeof(T)).data(), sizeof(T));
+
+		return detail::fromUnsigned<Endian, T>(bits);
+	}
+
+	/**
+	 * @brief Reads an unsigned LEB128 varint.
+	 * 
+	 * @return Value
+	 * @throws std::out_of_range If not enough data is left or the varint is malformed
+	 */
+	[[nodiscard]] uint64_t read_varint()
+	{
+		uint64_t value{};
+
+		for (unsigned shift{}; shift < 64; shift += 7)
+		{
+			const auto byte{std::to_integer<uint8_t>(take(1)[0])};
+
+			// the tenth byte holds only the highest bit
+			if (shift == 63 && byte > 1)
+			{
+				throw std::out_of_range("malformed varint");
+			}
+
+			value |= uint64_t{byte & 0x7fu} << shift;
+
+			if (!(byte & 0x80))
+			{
+				return value;
+			}
+		}
+
+		throw std::out_of_range("varint is too long");
+	}
+
+	/**
+	 * @brief Reads a signed LEB128 varint.
+	 * 
+	 * @return Value
+	 * @throws std::out_of_range If not enough data is left or the varint is malformed
+	 */
+	[[nodiscard]] int64_t read_signed_varint()
+	{
+		uint64_t value{};
+
+		for (unsigned shift{}; shift < 64; shift += 7)
+		{
+			const auto byte{std::to_integer<uint8_t>(take(1)[0])};
+
+			// the tenth byte holds only the highest bit and its sign extension
+			if (shift == 63 && byte != 0 && byte != 0x7f)
+			{
+				throw std::out_of_range("malformed varint");
+			}
+
+			value |= uint64_t{byte & 0x7fu} << shift;
+
+			if (!(byte & 0x80))
+			{
+				// sign extension of the last group
+				if (shift + 7 < 64 && (byte & 0x40))
+				{
+					value |= ~uint64_t{} << (shift + 7);
+				}
+
+				return static_cast<int64_t>(value);
+			}
+		}
+
+		throw std::out_of_range("varint is too long");
+	}
+
+	/**
+	 * @brief Reads raw bytes.
+	 * 
+	 * @param size Number of bytes
+	 * @return View of the bytes in the read data
+	 * @throws std::out_of_range If not enough data is left
+	 */
+	[[nodiscard]] std::span<const std::byte> read_bytes(BufferSize size)
+	{
+		return take(size);
+	}
+
+	/**
+	 * @brief Reads a string prefixed with its length as varint.
+	 * 
+	 * @return View of the string in the read data
+	 * @throws std::out_of_range If not enough data is left
+	 */
+	[[nodiscard]] std::string_view read_string()
+	{
+		const auto size{read_varint()};
+
+		if (size > remaining())
+		{
+			throw std::out_of_range("not enough data to read");
+		}
+
+		const auto bytes{take(static_cast<BufferSize>(size))};
+
+		return {reinterpret_cast<const char*>(bytes.data()), bytes.size()};
+	}
+
+	/**
+	 * @brief Returns the number of bytes already read.
+	 * 
+	 * @return Read position
+	 */
+	[[nodiscard]] BufferSize position() const noexcept
+	{
+		return position_;
+	}
+
+	/**
+	 * @brief Returns the number of bytes left to read.
+	 * 
+	 * @return Number of unread bytes
+	 */
+	[[nodiscard]] BufferSize remaining() const noexcept
+	{
+		return data_.size() - position_;
+	}
+
+private:
+	std::span<const std::byte> take(BufferSize size)
+	{
+		if (size > remaining())
+		{
+			throw std::out_of_range("not enough data to read");
+		}
+
+		const auto bytes{data_.subspan(position_, size)};
+		position_ += size;
+
+		return bytes;
+	}
+
+	std::span<const std::byte> data_;
+	BufferSize position_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_BUFFER_CURSOR_HPP
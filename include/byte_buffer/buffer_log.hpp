@@ -0,0 +1,143 @@
+#ifndef INCLUDE_BYTE_BUFFER_BUFFER_LOG_HPP
+#define INCLUDE_BYTE_BUFFER_BUFFER_LOG_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <span>
+
+namespace byte_buffer
+{
+/**
+ * @brief Append-only log of byte records in a memory-mapped file.
+ * 
+ * A record is a 32-bit payload size and a CRC-32C of the size and the payload, followed by the payload
+ * padded to 8 bytes. The file grows in steps within an address range reserved up front, so the mapping never
+ * moves and payload views stay valid for the lifetime of the log. Opening a log drops the records after
+ * the first one failing its checksum, i.e. a record torn by a crash and everything behind it.
+ */
+class BufferLog final
+{
+public:
+	static constexpr std::size_t defaultMaxSize{std::size_t{1} << 36};
+	static constexpr std::size_t growthStep{1 << 20};
+	static constexpr std::size_t recordHeaderSize{8};
+	static constexpr std::size_t maxPayloadSize{std::numeric_limits<uint32_t>::max()};
+
+	/**
+	 * @brief Forward iterator over the record payloads, which point into the mapping.
+	 */
+	class Iterator final
+	{
+	public:
+		using iterator_category = std::forward_iterator_tag;
+		using value_type = std::span<const std::byte>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = value_type;
+
+		Iterator() noexcept = default;
+
+		[[nodiscard]] value_type operator*() const noexcept;
+		Iterator& operator++() noexcept;
+		Iterator operator++(int) noexcept;
+		[[nodiscard]] bool operator==(const Iterator&) const noexcept = default;
+
+	private:
+		friend class BufferLog;
+
+		explicit Iterator(const std::byte* record) noexcept;
+
+		const std::byte* record_{};
+	};
+
+	/**
+	 * @brief Opens or creates a log and recovers its records.
+	 * 
+	 * @param path File path
+	 * @param maxSize Maximal file size, the address range reserved for the mapping
+	 * @throws std::system_error If the file cannot be opened, grown or mapped
+	 * @throws std::runtime_error If the file is not a buffer log
+	 * @throws std::length_error If the file is larger than `maxSize`
+	 */
+	explicit BufferLog(const std::filesystem::path& path, std::size_t maxSize = defaultMaxSize);
+
+	BufferLog(const BufferLog&) = delete;
+	BufferLog& operator=(const BufferLog&) = delete;
+
+	/**
+	 * @brief Unmaps and closes the log, records not synced yet are written back by the kernel unless the system crashes.
+	 */
+	~BufferLog();
+
+	/**
+	 * @brief Appends a record, safe to call from several threads.
+	 * 
+	 * @param payload Record payload
+	 * @return Log size including the record, pass it to `sync` to make the record durable
+	 * @throws std::length_error If the payload exceeds `maxPayloadSize` or the log would exceed its maximal size
+	 * @throws std::system_error If the file cannot be grown
+	 */
+	uint64_t append(std::span<const std::byte> payload);
+
+	/**
+	 * @brief Writes the records up to the position to disk with `msync`.
+	 * 
+	 * Threads syncing at the same time share a single flush of all records appended so far (group commit),
+	 * so a thread often returns without flushing itself.
+	 * 
+	 * @param position Log size returned by `append`
+	 * @throws std::system_error If flushing fails
+	 */
+	void sync(uint64_t position);
+
+	/**
+	 * @brief Writes all appended records to disk.
+	 * 
+	 * @throws std::system_error If flushing fails
+	 */
+	void sync();
+
+	/**
+	 * @brief Returns an iterator to the first record.
+	 * 
+	 * @return Iterator
+	 */
+	[[nodiscard]] Iterator begin() const noexcept;
+
+	/**
+	 * @brief Returns an iterator past the records appended so far.
+	 * 
+	 * @return Iterator
+	 */
+	[[nodiscard]] Iterator end() const noexcept;
+
+	/**
+	 * @brief Returns the log size, i.e. the file header and all records.
+	 * 
+	 * @return Log size in bytes
+	 */
+	[[nodiscard]] uint64_t size() const noexcept;
+
+private:
+	void recover(std::size_t fileSize);
+	void grow(std::size_t size);
+	void destroy() noexcept;
+
+	int fd_;
+	std::byte* mapping_;
+	std::size_t maxSize_;
+	std::size_t capacity_;
+	uint64_t size_;
+	uint64_t syncedSize_;
+	bool syncing_;
+	mutable std::mutex mutex_;
+	std::condition_variable synced_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_BUFFER_LOG_HPP
@@ -0,0 +1,135 @@
+#ifndef INCLUDE_BYTE_BUFFER_BUFFER_POOL_HPP
+#define INCLUDE_BYTE_BUFFER_BUFFER_POOL_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <memory_resource>
+#include <vector>
+
+#include "byte_buffer.hpp"
+
+namespace byte_buffer
+{
+/**
+ * @brief Usage counters of a buffer pool.
+ */
+struct BufferPoolStats
+{
+	std::size_t hits;          ///< Acquisitions served without allocating, by a retained buffer or the inline storage
+	std::size_t misses;        ///< Acquisitions that allocated a new buffer
+	std::size_t retainedBytes; ///< Capacity of all retained buffers
+};
+
+/**
+ * @brief Recycles buffers of repeating capacities to avoid allocating their storage again.
+ * 
+ * Returned buffers are kept in free lists bucketed by power-of-two size classes until the retained capacity
+ * reaches the limit. The pool is not synchronized, use `thread_buffer_pool` to get one per thread.
+ */
+class BufferPool final
+{
+public:
+	static constexpr BufferSize minPooledCapacity{2 * Buffer::inlineCapacity};
+	static constexpr BufferSize maxPooledCapacity{1 << 20};
+	static constexpr std::size_t defaultMaxRetainedBytes{16 << 20};
+
+	/**
+	 * @brief Owns an acquired buffer and returns it to its pool on destruction.
+	 * 
+	 * The handle must be destroyed on the thread owning the pool, while the pool is alive.
+	 */
+	class Handle final
+	{
+	public:
+		Handle() noexcept;
+		Handle(const Handle&) = delete;
+		Handle(Handle&& obj) noexcept;
+		Handle& operator=(const Handle&) = delete;
+		Handle& operator=(Handle&& obj);
+		~Handle();
+
+		[[nodiscard]] Buffer& operator*() noexcept;
+		[[nodiscard]] const Buffer& operator*() const noexcept;
+		[[nodiscard]] Buffer* operator->() noexcept;
+		[[nodiscard]] const Buffer* operator->() const noexcept;
+
+		/**
+		 * @brief Detaches the buffer from the pool, it is not returned on destruction.
+		 * 
+		 * @return Buffer
+		 */
+		[[nodiscard]] Buffer release() noexcept;
+
+	private:
+		friend class BufferPool;
+
+		Handle(BufferPool* pool, Buffer&& buffer) noexcept;
+
+		void recycle() noexcept;
+
+		BufferPool* pool_;
+		Buffer buffer_;
+	};
+
+	/**
+	 * @brief Creates a pool.
+	 * 
+	 * @param maxRetainedBytes Maximal capacity of the retained buffers
+	 * @param resource Memory resource the buffers are allocated from
+	 */
+	explicit BufferPool(std::size_t maxRetainedBytes = defaultMaxRetainedBytes,
+		std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept;
+
+	BufferPool(const BufferPool&) = delete;
+	BufferPool& operator=(const BufferPool&) = delete;
+
+	/**
+	 * @brief Returns an empty buffer with at least the given capacity.
+	 * 
+	 * Capacities fitting the inline storage need no allocation and count as a hit.
+	 * 
+	 * @param capacity Minimal buffer capacity
+	 * @return Handle returning the buffer to the pool
+	 */
+	[[nodiscard]] Handle acquire(BufferSize capacity);
+
+	/**
+	 * @brief Frees all retained buffers.
+	 */
+	void trim() noexcept;
+
+	/**
+	 * @brief Sets the maximal capacity of the retained buffers, retained buffers over the limit are freed.
+	 * 
+	 * @param maxRetainedBytes Maximal capacity of the retained buffers
+	 */
+	void set_max_retained_bytes(std::size_t maxRetainedBytes) noexcept;
+
+	/**
+	 * @brief Returns the usage counters.
+	 * 
+	 * @return Usage counters
+	 */
+	[[nodiscard]] BufferPoolStats stats() const noexcept;
+
+private:
+	static constexpr std::size_t classCount{static_cast<std::size_t>(std::bit_width(maxPooledCapacity) - std::bit_width(minPooledCapacity)) + 1};
+
+	void recycle(Buffer&& buffer) noexcept;
+
+	std::array<std::vector<Buffer>, classCount> freeLists_;
+	std::size_t maxRetainedBytes_;
+	std::pmr::memory_resource* resource_;
+	BufferPoolStats stats_;
+};
+
+/**
+ * @brief Returns the buffer pool of the calling thread.
+ * 
+ * @return Thread-local buffer pool
+ */
+[[nodiscard]] BufferPool& thread_buffer_pool();
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_BUFFER_POOL_HPP
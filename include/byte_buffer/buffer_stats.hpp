@@ -0,0 +1,65 @@
+#ifndef INCLUDE_BYTE_BUFFER_BUFFER_STATS_HPP
+#define INCLUDE_BYTE_BUFFER_BUFFER_STATS_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+namespace byte_buffer
+{
+/**
+ * @brief Checks if buffers are instrumented, which is enabled by the `BYTE_BUFFER_WITH_STATS` option.
+ * 
+ * Without it the counting calls are compiled out and all counters stay zero.
+ */
+#ifdef BYTE_BUFFER_WITH_STATS
+inline constexpr bool buffer_stats_enabled{true};
+#else
+inline constexpr bool buffer_stats_enabled{false};
+#endif
+
+/**
+ * @brief Storage activity of the buffers used by a thread.
+ * 
+ * Frees are counted on the thread that frees the storage, so `liveCapacity` may become negative
+ * when buffers are passed between threads.
+ */
+struct BufferStats
+{
+	static constexpr std::size_t histogramSize{std::numeric_limits<std::size_t>::digits + 1};
+
+	uint64_t allocations;   ///< Heap allocations of buffer storage
+	uint64_t frees;         ///< Heap deallocations of buffer storage
+	uint64_t reallocations; ///< Allocations replacing existing storage with a larger one
+	uint64_t bytesCopied;   ///< Bytes copied into buffers and between their allocations
+	uint64_t wastedBytes;   ///< Unused capacity (`capacity() - size()`) of the freed allocations
+	int64_t liveCapacity;   ///< Capacity of the allocations not freed yet
+	int64_t peakCapacity;   ///< Highest `liveCapacity`
+
+	/// Allocations by size, bucket `i` counts the sizes of `std::bit_width(size) == i`, i.e. [2^(i-1), 2^i)
+	std::array<uint64_t, histogramSize> allocationSizes;
+};
+
+/**
+ * @brief Returns a snapshot of the counters of the calling thread.
+ * 
+ * @return Buffer stats
+ */
+[[nodiscard]] BufferStats thread_buffer_stats() noexcept;
+
+/**
+ * @brief Resets the counters of the calling thread.
+ */
+void reset_thread_buffer_stats() noexcept;
+
+namespace detail
+{
+void count_allocation(std::size_t capacity) noexcept;
+void count_free(std::size_t capacity, std::size_t size) noexcept;
+void count_reallocation() noexcept;
+void count_copy(std::size_t size) noexcept;
+} // namespace detail
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_BUFFER_STATS_HPP
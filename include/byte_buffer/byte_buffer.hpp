@@ -1,19 +1,86 @@
 #ifndef INCLUDE_BYTE_BUFFER_HPP
 #define INCLUDE_BYTE_BUFFER_HPP
 
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <fstream>
+#include <memory_resource>
 #include <span>
 
 namespace byte_buffer
 {
+#ifdef BYTE_BUFFER_COMPACT_SIZE
+using BufferSize = uint32_t;
+#else
+using BufferSize = std::size_t;
+#endif
+
+/**
+ * @brief Strategy used to choose the new capacity when appended data does not fit into the buffer.
+ */
+enum class GrowthPolicy : uint8_t
+{
+	exact,         ///< Allocates exactly the required size
+	geometric_1_5, ///< Grows the capacity by a factor of 1.5
+	geometric_2,   ///< Doubles the capacity
+	page_rounded,  ///< Rounds the required size up to a multiple of `Buffer::pageSize`
+	fixed_chunk    ///< Rounds the required size up to a multiple of `Buffer::chunkSize`
+};
+
+class Buffer;
+class AppendOperation;
+class WriteOperation;
+
+/**
+ * @brief Single read of a batch submitted with `Buffer::read_batch`.
+ */
+struct ReadRequest
+{
+	Buffer* buffer;         ///< Buffer the read data is appended to
+	int fd;                 ///< File descriptor
+	uint64_t offset;        ///< Read offset in the file
+	BufferSize size;        ///< Number of bytes to read
+	BufferSize bytesRead{}; ///< Number of bytes actually read, set on completion
+};
+
+/**
+ * @brief Condition under which `Buffer::clear` frees the buffer storage.
+ */
+struct TrimPolicy
+{
+	uint8_t utilizationPercent; ///< Utilization (`size() * 100 / capacity()`) a clear must stay below to count
+	uint8_t clears;             ///< Number of consecutive low-utilization clears that free the storage, 0 disables trimming
+};
+
+/**
+ * @brief Raw storage released by `Buffer::release`.
+ * 
+ * The owner frees it with `resource->deallocate(data, capacity, alignment)`.
+ */
+struct BufferStorage
+{
+	std::byte* data;                     ///< Storage, `nullptr` if the buffer had none
+	BufferSize size;                     ///< Size of the data at the start of the storage
+	BufferSize capacity;                 ///< Storage size
+	std::size_t alignment;               ///< Storage alignment
+	std::pmr::memory_resource* resource; ///< Memory resource the storage was allocated from
+};
+
 class Buffer final
 {
 public:
+	static constexpr BufferSize pageSize{4096};
+	static constexpr BufferSize chunkSize{64 * 1024};
+	static constexpr BufferSize inlineCapacity{64};
+	static constexpr std::size_t defaultAlignment{alignof(std::max_align_t)};
+
 	Buffer() noexcept;
-	Buffer(std::span<const std::byte> bytes);
+	explicit Buffer(std::pmr::memory_resource* resource) noexcept;
+	explicit Buffer(GrowthPolicy growthPolicy, std::pmr::memory_resource* resource = std::pmr::get_default_resource()) noexcept;
+	Buffer(std::span<const std::byte> bytes, std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 	Buffer(const Buffer&);
-	Buffer(Buffer&&);
+	Buffer(Buffer&&) noexcept;
 	Buffer& operator=(const Buffer&);
 	Buffer& operator=(Buffer&&);
 	~Buffer();
@@ -23,7 +90,7 @@ public:
 	 * 
 	 * @param capacity New buffer capacity
 	 */
-	void reserve(uint32_t capacity);
+	void reserve(BufferSize capacity);
 
 	/**
 	 * @brief Overwrites the buffer data.
@@ -38,7 +105,7 @@ public:
 	 * @param file File object
 	 * @param size File data size
 	 */
-	void overwrite(std::ifstream& file, uint32_t size);
+	void overwrite(std::ifstream& file, BufferSize size);
 
 	/**
 	 * @brief Appends data to the buffer.
@@ -53,7 +120,129 @@ public:
 	 * @param file File object
 	 * @param size File data size
 	 */
-	void append(std::ifstream& file, uint32_t size);
+	void append(std::ifstream& file, BufferSize size);
+
+	/**
+	 * @brief Changes the size of the buffer without initializing the added bytes.
+	 * 
+	 * @param size New buffer data size
+	 */
+	void resize_uninitialized(BufferSize size);
+
+	/**
+	 * @brief Provides a writable window right after the buffer data, growing the buffer if needed.
+	 * 
+	 * The written bytes become part of the buffer data after `commit`.
+	 * The window is invalidated by any call that changes the buffer capacity.
+	 * 
+	 * @param size Window size
+	 * @return Writable window
+	 */
+	[[nodiscard]] std::span<std::byte> prepare(BufferSize size);
+
+	/**
+	 * @brief Appends bytes written into the window returned by `prepare` to the buffer data.
+	 * 
+	 * @param size Number of written bytes
+	 * @throws std::out_of_range If `size` exceeds the free space of the buffer
+	 */
+	void commit(BufferSize size);
+
+	/**
+	 * @brief Appends data to the buffer from file descriptor.
+	 * 
+	 * Reads until `size` bytes are read or end of file is reached.
+	 * 
+	 * @param fd File descriptor
+	 * @param size Number of bytes to read
+	 * @return Number of bytes read
+	 * @throws std::system_error If reading fails
+	 */
+	BufferSize read_from(int fd, BufferSize size);
+
+	/**
+	 * @brief Appends data to the buffer from file descriptor at the given offset, the file offset is not changed.
+	 * 
+	 * @param fd File descriptor
+	 * @param size Number of bytes to read
+	 * @param offset Read offset in the file
+	 * @return Number of bytes read
+	 * @throws std::system_error If reading fails
+	 */
+	BufferSize read_from(int fd, BufferSize size, uint64_t offset);
+
+	/**
+	 * @brief Writes the buffer data to file descriptor.
+	 * 
+	 * @param fd File descriptor
+	 * @throws std::system_error If writing fails
+	 */
+	void write_to(int fd) const;
+
+	/**
+	 * @brief Writes the buffer data to file descriptor at the given offset, the file offset is not changed.
+	 * 
+	 * @param fd File descriptor
+	 * @param offset Write offset in the file
+	 * @throws std::system_error If writing fails
+	 */
+	void write_to(int fd, uint64_t offset) const;
+
+	/**
+	 * @brief Appends data to the buffer from file descriptor without blocking the thread, awaited in a coroutine.
+	 * 
+	 * Reads until `size` bytes are read or end of file is reached, suspending on the thread event loop
+	 * (`thread_event_loop` in async_io.hpp) while a non-blocking pipe or socket has no data. The buffer is grown
+	 * once to fit `size` more bytes and must not change until the read completes.
+	 * 
+	 * @param fd File descriptor
+	 * @param size Number of bytes to read
+	 * @return Awaitable resuming with the number of bytes read
+	 */
+	[[nodiscard]] AppendOperation async_append(int fd, BufferSize size);
+
+	/**
+	 * @brief Writes the buffer data to file descriptor without blocking the thread, awaited in a coroutine.
+	 * 
+	 * The data must not change until the write completes.
+	 * 
+	 * @param fd File descriptor
+	 * @return Awaitable resuming once all data is written
+	 */
+	[[nodiscard]] WriteOperation async_write(int fd) const;
+
+	/**
+	 * @brief Fills the free space of the buffers from file descriptor with a single vectored read.
+	 * 
+	 * The free space of a buffer is `capacity() - size()`, use `reserve` to provide it.
+	 * 
+	 * @param fd File descriptor
+	 * @param buffers Buffers to fill in order
+	 * @return Number of bytes read
+	 * @throws std::system_error If reading fails
+	 */
+	static std::size_t read_from(int fd, std::span<Buffer* const> buffers);
+
+	/**
+	 * @brief Writes the data of the buffers to file descriptor with vectored writes.
+	 * 
+	 * @param fd File descriptor
+	 * @param buffers Buffers to write in order
+	 * @throws std::system_error If writing fails
+	 */
+	static void write_to(int fd, std::span<const Buffer* const> buffers);
+
+	/**
+	 * @brief Performs a batch of positioned reads.
+	 * 
+	 * With io_uring support (`BYTE_BUFFER_WITH_IO_URING`) the reads are submitted together to an io_uring
+	 * instance kept per thread, otherwise they are performed one by one with `pread`. Both backends resume
+	 * short reads until the request size or the end of file. Every request must refer to a different buffer.
+	 * 
+	 * @param requests Read requests
+	 * @throws std::system_error If any read fails
+	 */
+	static void read_batch(std::span<ReadRequest> requests);
 
 	/**
 	 * @brief Returns buffer data.
@@ -67,14 +256,16 @@ public:
 	 * 
 	 * @return Buffer data size
 	 */
-	[[nodiscard]] uint32_t size() const noexcept;
+	[[nodiscard]] BufferSize size() const noexcept;
 
 	/**
 	 * @brief Returns the size of memory currently allocated for the buffer.
 	 * 
+	 * Capacities up to `inlineCapacity` are served from storage inside the buffer object without heap allocation.
+	 * 
 	 * @return Size of space allocated in buffer
 	 */
-	[[nodiscard]] uint32_t capacity() const noexcept;
+	[[nodiscard]] BufferSize capacity() const noexcept;
 
 	/**
 	 * @brief Checks if the buffer is empty.
@@ -84,19 +275,119 @@ public:
 	[[nodiscard]] bool empty() const noexcept;
 
 	/**
-	 * @brief Removes all data from the buffer.
+	 * @brief Removes all data from the buffer, the storage is freed if the trim policy says so.
 	 */
 	void clear();
 
+	/**
+	 * @brief Reduces the capacity of the buffer to its size, small data is moved to the inline storage.
+	 */
+	void shrink_to_fit();
+
+	/**
+	 * @brief Hands the storage over to the caller, the buffer is left empty.
+	 * 
+	 * Data held in the inline storage is copied to a new allocation first.
+	 * 
+	 * @return Released storage
+	 */
+	[[nodiscard]] BufferStorage release();
+
+	/**
+	 * @brief Sets the condition under which `clear` frees the buffer storage.
+	 * 
+	 * Long-lived buffers give back the memory taken by an occasional large message once the following
+	 * messages keep using only a small part of it.
+	 * 
+	 * @param trimPolicy Trim policy
+	 */
+	void set_trim_policy(TrimPolicy trimPolicy) noexcept;
+
+	/**
+	 * @brief Returns the condition under which `clear` frees the buffer storage.
+	 * 
+	 * @return Trim policy
+	 */
+	[[nodiscard]] TrimPolicy trim_policy() const noexcept;
+
+	/**
+	 * @brief Sets the alignment of the buffer storage, the data is moved to a new allocation if needed.
+	 * 
+	 * Alignments stricter than `defaultAlignment` disable the inline storage.
+	 * 
+	 * @param alignment Power of two alignment, e.g. 64 for cache lines, 4096 for `O_DIRECT` or 2 MiB for huge pages
+	 * @throws std::invalid_argument If `alignment` is not a power of two
+	 */
+	void set_alignment(std::size_t alignment);
+
+	/**
+	 * @brief Returns the alignment of the buffer storage.
+	 * 
+	 * @return Alignment
+	 */
+	[[nodiscard]] std::size_t alignment() const noexcept;
+
+	/**
+	 * @brief Sets the strategy used to grow the buffer on append.
+	 * 
+	 * @param growthPolicy Growth policy
+	 */
+	void set_growth_policy(GrowthPolicy growthPolicy) noexcept;
+
+	/**
+	 * @brief Returns the strategy used to grow the buffer on append.
+	 * 
+	 * @return Growth policy
+	 */
+	[[nodiscard]] GrowthPolicy growth_policy() const noexcept;
+
+	/**
+	 * @brief Returns the memory resource the buffer storage is allocated from.
+	 * 
+	 * @return Memory resource
+	 */
+	[[nodiscard]] std::pmr::memory_resource* resource() const noexcept;
+
 private:
+	friend class AppendOperation;
+
 	void destroy();
-	void reallocate(uint32_t size, bool saveExistingData);
+	void steal(Buffer& obj) noexcept;
+	[[nodiscard]] bool isInline() const noexcept;
+	void reallocate(BufferSize size, bool saveExistingData);
 	void copy(std::span<const std::byte>, bool saveExistingData);
+	void grow(BufferSize size);
+	[[nodiscard]] BufferSize requiredSize(std::size_t size) const;
+	[[nodiscard]] BufferSize grownCapacity(BufferSize requiredSize) const noexcept;
 
 	std::byte* data_;
-	uint32_t dataSize_;
-	uint32_t capacity_;
+	BufferSize dataSize_;
+	BufferSize capacity_;
+	GrowthPolicy growthPolicy_;
+	uint8_t alignmentShift_;
+	TrimPolicy trimPolicy_;
+	uint8_t lowUtilizationClears_;
+	std::pmr::memory_resource* resource_;
+	alignas(std::max_align_t) std::byte inlineData_[inlineCapacity];
 };
+
+/**
+ * @brief Interface shared by `Buffer` and `StaticBuffer`, lets generic code build data in either of them.
+ */
+template <typename T>
+concept BufferLike = requires(T& buffer, const T& constBuffer, std::span<const std::byte> bytes, BufferSize size) {
+	buffer.overwrite(bytes);
+	buffer.append(bytes);
+	buffer.clear();
+	{ buffer.prepare(size) } -> std::same_as<std::span<std::byte>>;
+	buffer.commit(size);
+	{ constBuffer.data() } -> std::same_as<std::span<const std::byte>>;
+	{ constBuffer.size() } -> std::convertible_to<std::size_t>;
+	{ constBuffer.capacity() } -> std::convertible_to<std::size_t>;
+	{ constBuffer.empty() } -> std::same_as<bool>;
+};
+
+static_assert(BufferLike<Buffer>);
 } // namespace byte_buffer
 
 #endif // INCLUDE_BYTE_BUFFER_HPP
@@ -0,0 +1,251 @@
+#ifndef INCLUDE_BYTE_BUFFER_BYTE_QUEUE_HPP
+#define INCLUDE_BYTE_BUFFER_BYTE_QUEUE_HPP
+
+#include <atomic>
+#include <cstring>
+#include <limits>
+#include <span>
+
+#include "byte_buffer.hpp"
+#include "mirrored_memory.hpp"
+
+namespace byte_buffer
+{
+namespace detail
+{
+constexpr std::size_t cacheLineSize{64};
+constexpr uint64_t recordHeaderSize{sizeof(uint64_t)};
+
+// records are a 64-bit header followed by the message padded to 8 bytes, so headers stay aligned
+constexpr uint64_t recordSize(uint64_t messageSize) noexcept
+{
+	return recordHeaderSize + (messageSize + 7) / 8 * 8;
+}
+} // namespace detail
+
+/**
+ * @brief Lock-free queue of byte messages for one producer and one consumer thread.
+ * 
+ * Messages are copied into a mirrored ring, so every message is contiguous in memory.
+ */
+class SpscByteQueue final
+{
+public:
+	/**
+	 * @brief Creates a queue.
+	 * 
+	 * @param capacity Minimal capacity in bytes, rounded up to a multiple of the page size
+	 * @throws std::system_error If the storage cannot be mapped
+	 */
+	explicit SpscByteQueue(BufferSize capacity);
+	SpscByteQueue(const SpscByteQueue&) = delete;
+	SpscByteQueue& operator=(const SpscByteQueue&) = delete;
+
+	/**
+	 * @brief Pushes a message, must be called by the producer thread only.
+	 * 
+	 * @param message Message
+	 * @return `True` if the message was pushed, `false` if the queue is full
+	 * @throws std::length_error If the message can never fit into the queue
+	 */
+	bool try_push(std::span<const std::byte> message);
+
+	/**
+	 * @brief Pushes as many messages as fit and publishes them at once, must be called by the producer thread only.
+	 * 
+	 * @param messages Messages
+	 * @return Number of pushed messages
+	 * @throws std::length_error If a message can never fit into the queue
+	 */
+	std::size_t try_push_batch(std::span<const std::span<const std::byte>> messages);
+
+	/**
+	 * @brief Passes the available messages to the handler and releases them at once, must be called by the consumer thread only.
+	 * 
+	 * The message view is valid only during the handler call.
+	 * 
+	 * @param handler Callable taking `std::span<const std::byte>`
+	 * @param maxMessages Maximal number of consumed messages
+	 * @return Number of consumed messages
+	 */
+	template <typename Handler>
+	std::size_t consume(Handler&& handler, std::size_t maxMessages = std::numeric_limits<std::size_t>::max())
+	{
+		const auto readPosition{readPosition_.load(std::memory_order_relaxed)};
+
+		if (cachedWritePosition_ == readPosition)
+		{
+			cachedWritePosition_ = writePosition_.load(std::memory_order_acquire);
+		}
+
+		auto position{readPosition};
+		std::size_t consumed{};
+
+		for (; position != cachedWritePosition_ && consumed < maxMessages; ++consumed)
+		{
+			const auto record{recordAt(position)};
+			uint64_t size;
+			std::memcpy(&size, record, sizeof(size));
+
+			handler(std::span<const std::byte>{record + detail::recordHeaderSize, static_cast<std::size_t>(size)});
+			position += detail::recordSize(size);
+		}
+
+		if (consumed)
+		{
+			readPosition_.store(position, std::memory_order_release);
+		}
+
+		return consumed;
+	}
+
+	/**
+	 * @brief Pops a message into the buffer, must be called by the consumer thread only.
+	 * 
+	 * @param message Buffer overwritten with the message
+	 * @return `True` if a message was popped, `false` if the queue is empty
+	 */
+	bool try_pop(Buffer& message);
+
+	/**
+	 * @brief Checks if the queue has no published messages.
+	 * 
+	 * @return `True` if the queue is empty, otherwise `false`
+	 */
+	[[nodiscard]] bool empty() const noexcept;
+
+	/**
+	 * @brief Returns the queue capacity in bytes.
+	 * 
+	 * @return Queue capacity
+	 */
+	[[nodiscard]] BufferSize capacity() const noexcept;
+
+private:
+	[[nodiscard]] std::byte* recordAt(uint64_t position) const noexcept;
+
+	MirroredMemory memory_;
+
+	// producer cache line
+	alignas(detail::cacheLineSize) std::atomic<uint64_t> writePosition_;
+	uint64_t cachedReadPosition_;
+
+	// consumer cache line
+	alignas(detail::cacheLineSize) std::atomic<uint64_t> readPosition_;
+	uint64_t cachedWritePosition_;
+};
+
+/**
+ * @brief Lock-free queue of byte messages for many producer threads and one consumer thread.
+ * 
+ * Producers claim space with a compare-and-swap and publish each message through its header,
+ * so a slow producer delays only the messages claimed after its own.
+ */
+class MpscByteQueue final
+{
+public:
+	/**
+	 * @brief Creates a queue.
+	 * 
+	 * @param capacity Minimal capacity in bytes, rounded up to a multiple of the page size
+	 * @throws std::system_error If the storage cannot be mapped
+	 */
+	explicit MpscByteQueue(BufferSize capacity);
+	MpscByteQueue(const MpscByteQueue&) = delete;
+	MpscByteQueue& operator=(const MpscByteQueue&) = delete;
+
+	/**
+	 * @brief Pushes a message, may be called by any thread.
+	 * 
+	 * @param message Message
+	 * @return `True` if the message was pushed, `false` if the queue is full
+	 * @throws std::length_error If the message can never fit into the queue
+	 */
+	bool try_push(std::span<const std::byte> message);
+
+	/**
+	 * @brief Pushes as many messages as fit with a single space claim, may be called by any thread.
+	 * 
+	 * @param messages Messages
+	 * @return Number of pushed messages
+	 * @throws std::length_error If a message can never fit into the queue
+	 */
+	std::size_t try_push_batch(std::span<const std::span<const std::byte>> messages);
+
+	/**
+	 * @brief Passes the published messages to the handler and releases them at once, must be called by the consumer thread only.
+	 * 
+	 * The message view is valid only during the handler call.
+	 * 
+	 * @param handler Callable taking `std::span<const std::byte>`
+	 * @param maxMessages Maximal number of consumed messages
+	 * @return Number of consumed messages
+	 */
+	template <typename Handler>
+	std::size_t consume(Handler&& handler, std::size_t maxMessages = std::numeric_limits<std::size_t>::max())
+	{
+		const auto readPosition{readPosition_.load(std::memory_order_relaxed)};
+		auto position{readPosition};
+		std::size_t consumed{};
+
+		// a full lap must stop at the first consumed record, its header is cleared only on release
+		for (; consumed < maxMessages && position - readPosition < memory_.size(); ++consumed)
+		{
+			const auto header{headerAt(position).load(std::memory_order_acquire)};
+
+			if (header == 0)
+			{
+				break;
+			}
+
+			const auto size{header - 1};
+			handler(std::span<const std::byte>{recordAt(position) + detail::recordHeaderSize, static_cast<std::size_t>(size)});
+			position += detail::recordSize(size);
+		}
+
+		if (consumed)
+		{
+			release(readPosition, position);
+		}
+
+		return consumed;
+	}
+
+	/**
+	 * @brief Pops a message into the buffer, must be called by the consumer thread only.
+	 * 
+	 * @param message Buffer overwritten with the message
+	 * @return `True` if a message was popped, `false` if no message is published
+	 */
+	bool try_pop(Buffer& message);
+
+	/**
+	 * @brief Checks if the next message is not published yet.
+	 * 
+	 * @return `True` if the queue is empty, otherwise `false`
+	 */
+	[[nodiscard]] bool empty() const noexcept;
+
+	/**
+	 * @brief Returns the queue capacity in bytes.
+	 * 
+	 * @return Queue capacity
+	 */
+	[[nodiscard]] BufferSize capacity() const noexcept;
+
+private:
+	[[nodiscard]] std::byte* recordAt(uint64_t position) const noexcept;
+	[[nodiscard]] std::atomic_ref<uint64_t> headerAt(uint64_t position) const noexcept;
+	void release(uint64_t from, uint64_t to) noexcept;
+
+	MirroredMemory memory_;
+
+	// producers cache line
+	alignas(detail::cacheLineSize) std::atomic<uint64_t> claimPosition_;
+
+	// consumer cache line
+	alignas(detail::cacheLineSize) std::atomic<uint64_t> readPosition_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_BYTE_QUEUE_HPP
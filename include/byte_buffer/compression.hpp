@@ -0,0 +1,162 @@
+#ifndef INCLUDE_BYTE_BUFFER_COMPRESSION_HPP
+#define INCLUDE_BYTE_BUFFER_COMPRESSION_HPP
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+#include "byte_buffer.hpp"
+
+namespace byte_buffer
+{
+/**
+ * @brief Compression format.
+ * 
+ * Codecs are compiled in with the `BYTE_BUFFER_WITH_LZ4` and `BYTE_BUFFER_WITH_ZSTD` options.
+ */
+enum class Codec : uint8_t
+{
+	lz4, ///< LZ4 frame format
+	zstd ///< Zstandard frame format
+};
+
+/**
+ * @brief Checks if the codec is compiled in.
+ * 
+ * @param codec Codec
+ * @return `True` if the codec can be used, otherwise `false`
+ */
+[[nodiscard]] bool codec_available(Codec codec) noexcept;
+
+/**
+ * @brief Compresses bytes into a single frame appended to the buffer.
+ * 
+ * The frame is written straight into the free space of the buffer, which is grown once to the codec bound.
+ * 
+ * @param codec Codec
+ * @param bytes Bytes to compress
+ * @param output Buffer the frame is appended to
+ * @param level Codec compression level, 0 selects the codec default
+ * @throws std::invalid_argument If the codec is not compiled in
+ * @throws std::runtime_error If compression fails
+ */
+void compress(Codec codec, std::span<const std::byte> bytes, Buffer& output, int level = 0);
+
+/**
+ * @brief Decompresses frames of unknown decompressed size appended to the buffer.
+ * 
+ * The buffer is grown once to the size in the frame header when present and plausible for the compressed size,
+ * otherwise the free space of the buffer is grown geometrically as data is decompressed.
+ * On failure the buffer keeps its previous data.
+ * 
+ * @param codec Codec
+ * @param bytes Compressed frames
+ * @param output Buffer the decompressed data is appended to
+ * @throws std::invalid_argument If the codec is not compiled in
+ * @throws std::runtime_error If the data is corrupted or truncated
+ */
+void decompress(Codec codec, std::span<const std::byte> bytes, Buffer& output);
+
+/**
+ * @brief Decompresses frames of known decompressed size appended to the buffer.
+ * 
+ * On failure the buffer keeps its previous data.
+ * 
+ * @param codec Codec
+ * @param bytes Compressed frames
+ * @param output Buffer the decompressed data is appended to
+ * @param size Decompressed size, the buffer is grown once to fit it
+ * @throws std::invalid_argument If the codec is not compiled in
+ * @throws std::length_error If the buffer would exceed the maximum size
+ * @throws std::runtime_error If the data is corrupted, truncated or larger than `size`
+ */
+void decompress(Codec codec, std::span<const std::byte> bytes, Buffer& output, BufferSize size);
+
+/**
+ * @brief Compresses a stream of chunks into a single frame appended to the buffer.
+ */
+class CompressionStream final
+{
+public:
+	/**
+	 * @brief Starts a frame.
+	 * 
+	 * @param codec Codec
+	 * @param output Buffer the frame is appended to, must outlive the stream
+	 * @param level Codec compression level, 0 selects the codec default
+	 * @throws std::invalid_argument If the codec is not compiled in
+	 */
+	CompressionStream(Codec codec, Buffer& output, int level = 0);
+
+	CompressionStream(const CompressionStream&) = delete;
+	CompressionStream& operator=(const CompressionStream&) = delete;
+
+	/**
+	 * @brief Compresses a chunk, the codec may hold back output until `finish`.
+	 * 
+	 * @param bytes Chunk
+	 * @throws std::runtime_error If compression fails
+	 */
+	void write(std::span<const std::byte> bytes);
+
+	/**
+	 * @brief Flushes the held back output and ends the frame.
+	 * 
+	 * @throws std::runtime_error If compression fails
+	 */
+	void finish();
+
+private:
+	void begin();
+
+	Codec codec_;
+	Buffer& output_;
+	int level_;
+	bool begun_;
+	std::unique_ptr<void, void (*)(void*)> context_;
+};
+
+/**
+ * @brief Decompresses a stream of compressed chunks appended to the buffer.
+ */
+class DecompressionStream final
+{
+public:
+	/**
+	 * @brief Creates a stream.
+	 * 
+	 * @param codec Codec
+	 * @param output Buffer the decompressed data is appended to, must outlive the stream
+	 * @throws std::invalid_argument If the codec is not compiled in
+	 */
+	DecompressionStream(Codec codec, Buffer& output);
+
+	DecompressionStream(const DecompressionStream&) = delete;
+	DecompressionStream& operator=(const DecompressionStream&) = delete;
+
+	/**
+	 * @brief Decompresses a chunk, a frame may span any number of chunks.
+	 * 
+	 * @param bytes Compressed chunk
+	 * @throws std::runtime_error If the data is corrupted
+	 */
+	void write(std::span<const std::byte> bytes);
+
+	/**
+	 * @brief Checks if the data written so far ends at a frame boundary.
+	 * 
+	 * @return `True` if no frame is partially decompressed, otherwise `false`
+	 */
+	[[nodiscard]] bool finished() const noexcept;
+
+private:
+	[[nodiscard]] std::span<std::byte> window();
+
+	Codec codec_;
+	Buffer& output_;
+	bool finished_;
+	std::unique_ptr<void, void (*)(void*)> context_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_COMPRESSION_HPP
@@ -0,0 +1,143 @@
+#ifndef INCLUDE_BYTE_BUFFER_DIRECT_IO_HPP
+#define INCLUDE_BYTE_BUFFER_DIRECT_IO_HPP
+
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <future>
+#include <span>
+
+#include "byte_buffer.hpp"
+
+namespace byte_buffer
+{
+/**
+ * @brief Reads a file with `O_DIRECT` in block aligned chunks, bypassing the page cache.
+ * 
+ * While the caller processes a chunk the next one is read in the background. On file systems without direct I/O
+ * support the file is read through the page cache, which is told to drop the read pages.
+ */
+class DirectReader final
+{
+public:
+	static constexpr BufferSize blockSize{4096};
+	static constexpr BufferSize defaultChunkSize{4 << 20};
+
+	/**
+	 * @brief Opens a file and starts reading its first chunk.
+	 * 
+	 * @param path File path
+	 * @param offset Offset the reading starts at, it does not need to be aligned
+	 * @param chunkSize Chunk size, rounded up to a multiple of `blockSize`
+	 * @throws std::system_error If the file cannot be opened
+	 */
+	explicit DirectReader(const std::filesystem::path& path, uint64_t offset = 0, BufferSize chunkSize = defaultChunkSize);
+
+	DirectReader(const DirectReader&) = delete;
+	DirectReader& operator=(const DirectReader&) = delete;
+
+	~DirectReader();
+
+	/**
+	 * @brief Returns the next chunk of the file and starts reading the following one.
+	 * 
+	 * The chunk is valid until the next call.
+	 * 
+	 * @return Chunk, empty at the end of the file
+	 * @throws std::system_error If reading fails
+	 */
+	[[nodiscard]] std::span<const std::byte> next();
+
+	/**
+	 * @brief Appends the rest of the file to the buffer, which is grown once to fit it.
+	 * 
+	 * @param buffer Buffer
+	 * @throws std::system_error If reading fails
+	 */
+	void append_to(Buffer& buffer);
+
+	/**
+	 * @brief Checks if the page cache is bypassed.
+	 * 
+	 * @return `True` if the file is read with `O_DIRECT`, otherwise `false`
+	 */
+	[[nodiscard]] bool direct() const noexcept;
+
+private:
+	void prefetch();
+	void read(Buffer& chunk, uint64_t offset) const;
+
+	int fd_;
+	bool direct_;
+	uint64_t fileSize_;
+	uint64_t nextOffset_;
+	BufferSize skip_;
+	BufferSize chunkSize_;
+	std::array<Buffer, 2> chunks_;
+	std::size_t current_;
+	std::future<void> pending_;
+};
+
+/**
+ * @brief Writes a file with `O_DIRECT` in block aligned chunks, bypassing the page cache.
+ * 
+ * A full chunk is written in the background while the next one is filled. The last partial block is padded
+ * for the write and cut off by truncating the file in `close`.
+ */
+class DirectWriter final
+{
+public:
+	/**
+	 * @brief Creates or truncates a file.
+	 * 
+	 * @param path File path
+	 * @param chunkSize Chunk size, rounded up to a multiple of `DirectReader::blockSize`
+	 * @throws std::system_error If the file cannot be opened
+	 */
+	explicit DirectWriter(const std::filesystem::path& path, BufferSize chunkSize = DirectReader::defaultChunkSize);
+
+	DirectWriter(const DirectWriter&) = delete;
+	DirectWriter& operator=(const DirectWriter&) = delete;
+
+	/**
+	 * @brief Closes the file, errors are ignored, call `close` to handle them.
+	 */
+	~DirectWriter();
+
+	/**
+	 * @brief Writes data to the file.
+	 * 
+	 * @param bytes Bytes
+	 * @throws std::system_error If writing fails
+	 */
+	void write(std::span<const std::byte> bytes);
+
+	/**
+	 * @brief Writes the remaining data and closes the file.
+	 * 
+	 * @throws std::system_error If writing fails
+	 */
+	void close();
+
+	/**
+	 * @brief Checks if the page cache is bypassed.
+	 * 
+	 * @return `True` if the file is written with `O_DIRECT`, otherwise `false`
+	 */
+	[[nodiscard]] bool direct() const noexcept;
+
+private:
+	void submit();
+	void waitPending();
+
+	int fd_;
+	bool direct_;
+	uint64_t offset_;
+	BufferSize chunkSize_;
+	std::array<Buffer, 2> chunks_;
+	std::size_t current_;
+	std::future<void> pending_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_DIRECT_IO_HPP
@@ -0,0 +1,108 @@
+#ifndef INCLUDE_BYTE_BUFFER_KERNELS_HPP
+#define INCLUDE_BYTE_BUFFER_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+namespace byte_buffer::kernels
+{
+/**
+ * @brief Position returned by the search kernels when nothing is found.
+ */
+inline constexpr std::size_t npos{std::numeric_limits<std::size_t>::max()};
+
+/**
+ * @brief Finds the first occurrence of a byte.
+ * 
+ * @param data Searched data
+ * @param value Byte to find
+ * @return Position of the byte or `npos`
+ */
+[[nodiscard]] std::size_t find(std::span<const std::byte> data, std::byte value) noexcept;
+
+/**
+ * @brief Finds the first occurrence of a byte sequence.
+ * 
+ * @param data Searched data
+ * @param pattern Byte sequence to find, an empty pattern is found at position 0
+ * @return Position of the sequence or `npos`
+ */
+[[nodiscard]] std::size_t find(std::span<const std::byte> data, std::span<const std::byte> pattern) noexcept;
+
+/**
+ * @brief Checks if two byte sequences are equal.
+ * 
+ * @param lhs First sequence
+ * @param rhs Second sequence
+ * @return `True` if the sequences have the same size and bytes, otherwise `false`
+ */
+[[nodiscard]] bool equal(std::span<const std::byte> lhs, std::span<const std::byte> rhs) noexcept;
+
+/**
+ * @brief Computes the CRC-32C (Castagnoli) checksum.
+ * 
+ * @param data Data
+ * @param crc Checksum of the preceding data, allows to compute the checksum incrementally
+ * @return Checksum
+ */
+[[nodiscard]] uint32_t crc32c(std::span<const std::byte> data, uint32_t crc = 0) noexcept;
+
+/**
+ * @brief Computes the 64-bit xxHash (XXH64) of the data.
+ * 
+ * @param data Data
+ * @param seed Hash seed
+ * @return Hash
+ */
+[[nodiscard]] uint64_t hash64(std::span<const std::byte> data, uint64_t seed = 0) noexcept;
+
+/**
+ * @brief Copies bytes with non-temporal stores, which bypass the cache and do not evict data in use.
+ * 
+ * Pays off for destinations much larger than the cache that are not read soon.
+ * 
+ * @param destination Destination, at least as large as the source
+ * @param source Source
+ */
+void copy_non_temporal(std::span<std::byte> destination, std::span<const std::byte> source) noexcept;
+
+/**
+ * @brief Fills bytes with non-temporal stores, which bypass the cache and do not evict data in use.
+ * 
+ * @param destination Destination
+ * @param value Fill value
+ */
+void fill_non_temporal(std::span<std::byte> destination, std::byte value) noexcept;
+
+/**
+ * @brief Computes the CRC-32C of two concatenated sequences from their checksums.
+ * 
+ * @param crc Checksum of the first sequence
+ * @param nextCrc Checksum of the second sequence, computed with an initial checksum of 0
+ * @param nextSize Size of the second sequence
+ * @return Checksum of the concatenation
+ */
+[[nodiscard]] uint32_t crc32c_combine(uint32_t crc, uint32_t nextCrc, std::size_t nextSize) noexcept;
+
+/**
+ * @brief Returns the name of the instruction set the kernels were dispatched to on this CPU.
+ * 
+ * @return `"avx2"`, `"sse4.2"` or `"scalar"`
+ */
+[[nodiscard]] const char* isa() noexcept;
+
+/**
+ * @brief Portable implementations the dispatched kernels must agree with.
+ */
+namespace scalar
+{
+[[nodiscard]] std::size_t find(std::span<const std::byte> data, std::byte value) noexcept;
+[[nodiscard]] std::size_t find(std::span<const std::byte> data, std::span<const std::byte> pattern) noexcept;
+[[nodiscard]] bool equal(std::span<const std::byte> lhs, std::span<const std::byte> rhs) noexcept;
+[[nodiscard]] uint32_t crc32c(std::span<const std::byte> data, uint32_t crc = 0) noexcept;
+} // namespace scalar
+} // namespace byte_buffer::kernels
+
+#endif // INCLUDE_BYTE_BUFFER_KERNELS_HPP
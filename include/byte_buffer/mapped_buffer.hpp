@@ -0,0 +1,87 @@
+#ifndef INCLUDE_BYTE_BUFFER_MAPPED_BUFFER_HPP
+#define INCLUDE_BYTE_BUFFER_MAPPED_BUFFER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <span>
+
+namespace byte_buffer
+{
+/**
+ * @brief Expected access pattern of a mapped buffer, forwarded to the kernel as `madvise` hint.
+ */
+enum class AccessHint : uint8_t
+{
+	normal,     ///< No special treatment
+	sequential, ///< Pages are read in order, aggressive read-ahead
+	random,     ///< Pages are read in random order, no read-ahead
+	willneed    ///< Pages will be needed soon, start reading them in
+};
+
+/**
+ * @brief Read-only view of a file region mapped into memory.
+ */
+class MappedBuffer final
+{
+public:
+	static constexpr std::size_t toEnd{std::numeric_limits<std::size_t>::max()};
+
+	MappedBuffer() noexcept;
+
+	/**
+	 * @brief Maps a region of the file into memory.
+	 * 
+	 * @param path File path
+	 * @param offset Region offset in the file, does not have to be page aligned
+	 * @param length Region length, `toEnd` maps the file up to its end
+	 * @throws std::system_error If the file cannot be opened or mapped
+	 * @throws std::out_of_range If the region does not lie within the file
+	 */
+	explicit MappedBuffer(const std::filesystem::path& path, std::size_t offset = 0, std::size_t length = toEnd);
+	MappedBuffer(const MappedBuffer&) = delete;
+	MappedBuffer(MappedBuffer&&) noexcept;
+	MappedBuffer& operator=(const MappedBuffer&) = delete;
+	MappedBuffer& operator=(MappedBuffer&&) noexcept;
+	~MappedBuffer();
+
+	/**
+	 * @brief Tells the kernel how the mapped data is going to be accessed.
+	 * 
+	 * @param hint Access hint
+	 */
+	void advise(AccessHint hint) const;
+
+	/**
+	 * @brief Returns buffer data.
+	 * 
+	 * @return Buffer data
+	 */
+	[[nodiscard]] std::span<const std::byte> data() const noexcept;
+
+	/**
+	 * @brief Returns the size of the buffer data.
+	 * 
+	 * @return Buffer data size
+	 */
+	[[nodiscard]] std::size_t size() const noexcept;
+
+	/**
+	 * @brief Checks if the buffer is empty.
+	 * 
+	 * @return `True` if the buffer is empty, otherwise `false`
+	 */
+	[[nodiscard]] bool empty() const noexcept;
+
+private:
+	void destroy() noexcept;
+
+	void* mapping_;
+	std::size_t mappingSize_;
+	const std::byte* data_;
+	std::size_t dataSize_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_MAPPED_BUFFER_HPP
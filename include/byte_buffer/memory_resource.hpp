@@ -0,0 +1,91 @@
+#ifndef INCLUDE_BYTE_BUFFER_MEMORY_RESOURCE_HPP
+#define INCLUDE_BYTE_BUFFER_MEMORY_RESOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+
+namespace byte_buffer
+{
+/**
+ * @brief Returns the arena of the calling thread.
+ * 
+ * Allocations are carved sequentially from large blocks and deallocation is a no-op,
+ * the memory is returned in bulk by `release_thread_arena`.
+ * 
+ * @warning The arena is not synchronized and is destroyed when the thread exits. Buffers allocated from it
+ * must be modified and destroyed on the calling thread only, and before the thread exits.
+ * 
+ * @return Thread-local arena resource
+ */
+[[nodiscard]] std::pmr::memory_resource* thread_arena_resource();
+
+/**
+ * @brief Frees all memory allocated from the arena of the calling thread.
+ * 
+ * Buffers allocated from the arena must not be used after this call.
+ */
+void release_thread_arena();
+
+/**
+ * @brief Returns the size-class pool of the calling thread.
+ * 
+ * Freed blocks are kept in per-size-class free lists and reused by later allocations of the same class.
+ * 
+ * @warning The pool is not synchronized and is destroyed when the thread exits. Buffers allocated from it
+ * must be modified and destroyed on the calling thread only, and before the thread exits.
+ * 
+ * @return Thread-local pool resource
+ */
+[[nodiscard]] std::pmr::memory_resource* thread_pool_resource();
+
+/**
+ * @brief Backing of the pages allocated by `PageResource`.
+ */
+enum class HugePages : uint8_t
+{
+	none,        ///< Regular pages
+	transparent, ///< Regions aligned to `PageResource::hugePageSize` and advised with `MADV_HUGEPAGE`
+	reserved     ///< Pages from the reserved huge page pool (`MAP_HUGETLB`), allocation fails when the pool is exhausted
+};
+
+/**
+ * @brief Page backing and placement of the allocations of `PageResource`.
+ */
+struct PageOptions
+{
+	HugePages hugePages{HugePages::none}; ///< Huge page backing
+	int numaNode{-1};                     ///< NUMA node the pages are bound to, -1 keeps the default policy
+};
+
+/**
+ * @brief Allocates every block as a separate anonymous memory mapping.
+ * 
+ * Meant for large buffers, every block takes at least one page (or huge page). Any power of two alignment is supported.
+ */
+class PageResource final : public std::pmr::memory_resource
+{
+public:
+	static constexpr std::size_t hugePageSize{2 << 20};
+
+	explicit PageResource(PageOptions options = {}) noexcept;
+
+	/**
+	 * @brief Returns the page backing and placement of the allocations.
+	 * 
+	 * @return Page options
+	 */
+	[[nodiscard]] const PageOptions& options() const noexcept;
+
+private:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+	void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override;
+	[[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+	[[nodiscard]] std::size_t granularity() const noexcept;
+
+	PageOptions options_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_MEMORY_RESOURCE_HPP
@@ -0,0 +1,56 @@
+#ifndef INCLUDE_BYTE_BUFFER_MIRRORED_MEMORY_HPP
+#define INCLUDE_BYTE_BUFFER_MIRRORED_MEMORY_HPP
+
+#include <cstddef>
+
+#include "byte_buffer.hpp"
+
+namespace byte_buffer
+{
+/**
+ * @brief Memory block mapped twice back to back in virtual memory.
+ * 
+ * Byte `i` of the block is also visible at `data() + size() + i`, so any range of up to `size()` bytes
+ * starting inside the block is contiguous.
+ */
+class MirroredMemory final
+{
+public:
+	MirroredMemory() noexcept;
+
+	/**
+	 * @brief Maps a mirrored memory block.
+	 * 
+	 * @param size Minimal size, rounded up to a multiple of the page size
+	 * @throws std::system_error If the memory cannot be mapped
+	 */
+	explicit MirroredMemory(BufferSize size);
+	MirroredMemory(const MirroredMemory&) = delete;
+	MirroredMemory(MirroredMemory&&) noexcept;
+	MirroredMemory& operator=(const MirroredMemory&) = delete;
+	MirroredMemory& operator=(MirroredMemory&&) noexcept;
+	~MirroredMemory();
+
+	/**
+	 * @brief Returns the beginning of the block.
+	 * 
+	 * @return Block address
+	 */
+	[[nodiscard]] std::byte* data() const noexcept;
+
+	/**
+	 * @brief Returns the size of the block, the mirrored mapping is twice as large.
+	 * 
+	 * @return Block size
+	 */
+	[[nodiscard]] BufferSize size() const noexcept;
+
+private:
+	void destroy() noexcept;
+
+	std::byte* data_;
+	BufferSize size_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_MIRRORED_MEMORY_HPP
@@ -0,0 +1,166 @@
+#ifndef INCLUDE_BYTE_BUFFER_PARALLEL_HPP
+#define INCLUDE_BYTE_BUFFER_PARALLEL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace byte_buffer
+{
+/**
+ * @brief Pool of threads splitting bulk byte operations into chunks, idle threads steal chunks from busy ones.
+ * 
+ * The calling thread takes part in every operation, so a pool of `n` threads starts `n - 1` workers.
+ * Operations submitted from several threads run one after another.
+ */
+class ThreadPool final
+{
+public:
+	static constexpr std::size_t defaultChunkSize{1 << 20};
+
+	/**
+	 * @brief Starts the worker threads.
+	 * 
+	 * @param threadCount Number of threads including the calling one, 0 selects the number of hardware threads
+	 * @param chunkSize Size of the chunks the operations are split into
+	 * @throws std::system_error If a thread cannot be started
+	 */
+	explicit ThreadPool(std::size_t threadCount = 0, std::size_t chunkSize = defaultChunkSize);
+
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool& operator=(const ThreadPool&) = delete;
+
+	~ThreadPool();
+
+	/**
+	 * @brief Returns the number of threads taking part in an operation.
+	 * 
+	 * @return Number of threads including the calling one
+	 */
+	[[nodiscard]] std::size_t thread_count() const noexcept;
+
+	/**
+	 * @brief Copies bytes in parallel.
+	 * 
+	 * @param destination Destination, at least as large as the source and not overlapping it
+	 * @param source Source
+	 * @param nonTemporal Whether to write with non-temporal stores, which do not evict the cache
+	 */
+	void copy(std::span<std::byte> destination, std::span<const std::byte> source, bool nonTemporal = false);
+
+	/**
+	 * @brief Fills bytes in parallel.
+	 * 
+	 * @param destination Destination
+	 * @param value Fill value
+	 * @param nonTemporal Whether to write with non-temporal stores, which do not evict the cache
+	 */
+	void fill(std::span<std::byte> destination, std::byte value, bool nonTemporal = false);
+
+	/**
+	 * @brief Computes the CRC-32C checksum in parallel, combining the checksums of the chunks.
+	 * 
+	 * @param data Data
+	 * @param crc Checksum of the preceding data
+	 * @return Checksum, equal to `kernels::crc32c(data, crc)`
+	 */
+	[[nodiscard]] uint32_t crc32c(std::span<const std::byte> data, uint32_t crc = 0);
+
+private:
+	using ChunkFunction = void (*)(const void* context, std::size_t chunk, std::size_t offset, std::size_t size);
+
+	struct alignas(64) WorkRange
+	{
+		std::mutex mutex;
+		std::size_t begin;
+		std::size_t end;
+	};
+
+	template <typename Function>
+	void forEachChunk(std::size_t size, const Function& function)
+	{
+		run(size, &function, [](const void* context, std::size_t chunk, std::size_t offset, std::size_t chunkSize) {
+			(*static_cast<const Function*>(context))(chunk, offset, chunkSize);
+		});
+	}
+
+	void run(std::size_t size, const void* context, ChunkFunction function);
+	void stop() noexcept;
+	void work(std::size_t self) noexcept;
+	[[nodiscard]] bool take(std::size_t self, std::size_t& chunk) noexcept;
+	void workerLoop(std::size_t self) noexcept;
+
+	std::size_t chunkSize_;
+	std::unique_ptr<WorkRange[]> ranges_;
+	std::vector<std::thread> workers_;
+	std::mutex submitMutex_;
+	std::mutex mutex_;
+	std::condition_variable wake_;
+	std::condition_variable done_;
+	uint64_t generation_;
+	std::size_t busyWorkers_;
+	bool stopping_;
+	std::size_t size_;
+	const void* context_;
+	ChunkFunction function_;
+};
+
+/**
+ * @brief Returns the pool shared by the parallel buffer copies, started on first use with a thread per hardware thread.
+ * 
+ * @return Process-wide thread pool
+ */
+[[nodiscard]] ThreadPool& default_thread_pool();
+
+/**
+ * @brief Condition under which buffers copy their data with `default_thread_pool`.
+ */
+struct ParallelCopyPolicy
+{
+	std::size_t threshold; ///< Smallest copy done in parallel, 0 disables parallel copies
+	bool nonTemporal;      ///< Whether parallel copies write with non-temporal stores
+};
+
+/**
+ * @brief Sets the parallel copy policy of all buffers, by default parallel copies are disabled.
+ * 
+ * @param policy Policy
+ */
+void set_parallel_copy_policy(const ParallelCopyPolicy& policy) noexcept;
+
+/**
+ * @brief Returns the parallel copy policy of all buffers.
+ * 
+ * @return Policy
+ */
+[[nodiscard]] ParallelCopyPolicy parallel_copy_policy() noexcept;
+
+namespace detail
+{
+inline std::atomic<std::size_t> parallelCopyThreshold{};
+
+void parallel_copy(std::byte* destination, const std::byte* source, std::size_t size);
+
+// copies with `std::memcpy` unless the size reaches the parallel copy threshold
+inline void copy_bytes(std::byte* destination, const std::byte* source, std::size_t size)
+{
+	if (const auto threshold{parallelCopyThreshold.load(std::memory_order_relaxed)}; threshold && size >= threshold)
+	{
+		parallel_copy(destination, source, size);
+	}
+	else
+	{
+		std::memcpy(destination, source, size);
+	}
+}
+} // namespace detail
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_PARALLEL_HPP
@@ -0,0 +1,105 @@
+#ifndef INCLUDE_BYTE_BUFFER_RING_BUFFER_HPP
+#define INCLUDE_BYTE_BUFFER_RING_BUFFER_HPP
+
+#include <cstdint>
+#include <span>
+
+#include "mirrored_memory.hpp"
+
+namespace byte_buffer
+{
+/**
+ * @brief Fixed-capacity circular buffer for streaming producer/consumer use.
+ * 
+ * The storage is mapped twice back to back in virtual memory, so the readable and writable regions
+ * are always contiguous, even when they wrap around the end of the storage.
+ */
+class RingBuffer final
+{
+public:
+	RingBuffer() noexcept;
+
+	/**
+	 * @brief Creates a ring buffer.
+	 * 
+	 * @param capacity Minimal capacity, rounded up to a multiple of the page size
+	 * @throws std::system_error If the storage cannot be mapped
+	 */
+	explicit RingBuffer(BufferSize capacity);
+	RingBuffer(const RingBuffer&) = delete;
+	RingBuffer(RingBuffer&&) noexcept;
+	RingBuffer& operator=(const RingBuffer&) = delete;
+	RingBuffer& operator=(RingBuffer&&) noexcept;
+
+	/**
+	 * @brief Returns the data available for reading.
+	 * 
+	 * @return Readable data
+	 */
+	[[nodiscard]] std::span<const std::byte> readable() const noexcept;
+
+	/**
+	 * @brief Returns the free space available for writing, the written bytes become readable after `commit`.
+	 * 
+	 * @return Writable space
+	 */
+	[[nodiscard]] std::span<std::byte> writable() noexcept;
+
+	/**
+	 * @brief Makes bytes written into the space returned by `writable` readable.
+	 * 
+	 * @param size Number of written bytes
+	 * @throws std::out_of_range If `size` exceeds the free space
+	 */
+	void commit(BufferSize size);
+
+	/**
+	 * @brief Removes bytes from the beginning of the readable data.
+	 * 
+	 * @param size Number of consumed bytes
+	 * @throws std::out_of_range If `size` exceeds the readable data size
+	 */
+	void consume(BufferSize size);
+
+	/**
+	 * @brief Copies as many bytes as fit into the free space.
+	 * 
+	 * @param bytes Bytes
+	 * @return Number of written bytes
+	 */
+	BufferSize write(std::span<const std::byte> bytes) noexcept;
+
+	/**
+	 * @brief Returns the size of the readable data.
+	 * 
+	 * @return Readable data size
+	 */
+	[[nodiscard]] BufferSize size() const noexcept;
+
+	/**
+	 * @brief Returns the buffer capacity.
+	 * 
+	 * @return Buffer capacity
+	 */
+	[[nodiscard]] BufferSize capacity() const noexcept;
+
+	/**
+	 * @brief Checks if there is no readable data.
+	 * 
+	 * @return `True` if the buffer is empty, otherwise `false`
+	 */
+	[[nodiscard]] bool empty() const noexcept;
+
+	/**
+	 * @brief Removes all data from the buffer.
+	 */
+	void clear() noexcept;
+
+private:
+	MirroredMemory memory_;
+	uint64_t readPosition_;
+	uint64_t writePosition_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_RING_BUFFER_HPP
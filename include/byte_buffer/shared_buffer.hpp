@@ -0,0 +1,91 @@
+#ifndef INCLUDE_BYTE_BUFFER_SHARED_BUFFER_HPP
+#define INCLUDE_BYTE_BUFFER_SHARED_BUFFER_HPP
+
+#include <memory>
+#include <span>
+
+#include "byte_buffer.hpp"
+
+namespace byte_buffer
+{
+/**
+ * @brief Reference-counted view of a buffer.
+ * 
+ * Copies and slices share the underlying storage, which is copied only when a shared instance is modified.
+ * Instances sharing storage may be used and released from different threads, a single instance must not be
+ * used by several threads at the same time.
+ */
+class SharedBuffer final
+{
+public:
+	SharedBuffer() noexcept;
+	SharedBuffer(std::span<const std::byte> bytes);
+	SharedBuffer(Buffer&& buffer);
+
+	/**
+	 * @brief Returns a view of a part of the buffer data sharing its storage.
+	 * 
+	 * @param offset Offset of the part
+	 * @param size Size of the part
+	 * @return Buffer part
+	 * @throws std::out_of_range If the part does not lie within the buffer data
+	 */
+	[[nodiscard]] SharedBuffer slice(BufferSize offset, BufferSize size) const;
+
+	/**
+	 * @brief Overwrites the buffer data, the storage is copied first if it is shared.
+	 * 
+	 * @param bytes Bytes
+	 */
+	void overwrite(std::span<const std::byte> bytes);
+
+	/**
+	 * @brief Appends data to the buffer, the storage is copied first if it is shared.
+	 * 
+	 * @param bytes Bytes
+	 */
+	void append(std::span<const std::byte> bytes);
+
+	/**
+	 * @brief Returns buffer data.
+	 * 
+	 * @return Buffer data
+	 */
+	[[nodiscard]] std::span<const std::byte> data() const noexcept;
+
+	/**
+	 * @brief Returns the size of the buffer data.
+	 * 
+	 * @return Buffer data size
+	 */
+	[[nodiscard]] BufferSize size() const noexcept;
+
+	/**
+	 * @brief Checks if the buffer is empty.
+	 * 
+	 * @return `True` if the buffer is empty, otherwise `false`
+	 */
+	[[nodiscard]] bool empty() const noexcept;
+
+	/**
+	 * @brief Checks if the buffer storage is not shared with other instances.
+	 * 
+	 * @return `True` if the storage is owned by this instance only, otherwise `false`
+	 */
+	[[nodiscard]] bool unique() const noexcept;
+
+	/**
+	 * @brief Removes all data from the buffer.
+	 */
+	void clear() noexcept;
+
+private:
+	void detach(BufferSize extraCapacity);
+
+	std::shared_ptr<Buffer> storage_;
+	BufferSize offset_;
+	BufferSize size_;
+};
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_SHARED_BUFFER_HPP
@@ -0,0 +1,196 @@
+#ifndef INCLUDE_BYTE_BUFFER_STATIC_BUFFER_HPP
+#define INCLUDE_BYTE_BUFFER_STATIC_BUFFER_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+#include "byte_buffer.hpp"
+
+namespace byte_buffer
+{
+namespace detail
+{
+// smallest unsigned type holding sizes up to the capacity
+template <std::size_t N>
+using StaticBufferSize = std::conditional_t<N <= std::numeric_limits<uint8_t>::max(), uint8_t,
+	std::conditional_t<N <= std::numeric_limits<uint16_t>::max(), uint16_t,
+		std::conditional_t<N <= std::numeric_limits<uint32_t>::max(), uint32_t, std::size_t>>>;
+} // namespace detail
+
+/**
+ * @brief Buffer of compile-time capacity keeping its data inside the object, it never allocates.
+ * 
+ * All operations are usable in constant expressions, so fixed messages can be built at compile time.
+ * Exceeding the capacity throws, which fails the compilation of a constant expression.
+ * 
+ * @tparam N Capacity
+ */
+template <std::size_t N>
+class StaticBuffer final
+{
+public:
+	constexpr StaticBuffer() noexcept = default;
+
+	/**
+	 * @brief Creates a buffer holding a copy of the bytes.
+	 * 
+	 * @param bytes Bytes
+	 * @throws std::length_error If the bytes exceed the capacity
+	 */
+	constexpr explicit StaticBuffer(std::span<const std::byte> bytes)
+	{
+		append(bytes);
+	}
+
+	/**
+	 * @brief Overwrites the buffer data.
+	 * 
+	 * @param bytes Bytes
+	 * @throws std::length_error If the bytes exceed the capacity
+	 */
+	constexpr void overwrite(std::span<const std::byte> bytes)
+	{
+		checkCapacity(0, bytes.size());
+		std::copy(bytes.begin(), bytes.end(), bytes_.begin());
+		size_ = static_cast<SizeType>(bytes.size());
+	}
+
+	/**
+	 * @brief Appends data to the buffer.
+	 * 
+	 * @param bytes Bytes
+	 * @throws std::length_error If the data would exceed the capacity
+	 */
+	constexpr void append(std::span<const std::byte> bytes)
+	{
+		checkCapacity(size_, bytes.size());
+		std::copy(bytes.begin(), bytes.end(), bytes_.begin() + size_);
+		size_ = static_cast<SizeType>(size_ + bytes.size());
+	}
+
+	/**
+	 * @brief Changes the size of the buffer, bytes added at compile time are zero.
+	 * 
+	 * @param size New buffer data size
+	 * @throws std::length_error If `size` exceeds the capacity
+	 */
+	constexpr void resize_uninitialized(BufferSize size)
+	{
+		checkCapacity(0, size);
+		size_ = static_cast<SizeType>(size);
+	}
+
+	/**
+	 * @brief Provides a writable window right after the buffer data.
+	 * 
+	 * The written bytes become part of the buffer data after `commit`.
+	 * 
+	 * @param size Window size
+	 * @return Writable window
+	 * @throws std::length_error If the window would exceed the capacity
+	 */
+	[[nodiscard]] constexpr std::span<std::byte> prepare(BufferSize size)
+	{
+		checkCapacity(size_, size);
+		return std::span(bytes_).subspan(size_, size);
+	}
+
+	/**
+	 * @brief Appends bytes written into the window returned by `prepare` to the buffer data.
+	 * 
+	 * @param size Number of written bytes
+	 * @throws std::out_of_range If `size` exceeds the free space of the buffer
+	 */
+	constexpr void commit(BufferSize size)
+	{
+		if (size > N - size_)
+		{
+			throw std::out_of_range("committed size exceeds the buffer free space");
+		}
+
+		size_ = static_cast<SizeType>(size_ + size);
+	}
+
+	/**
+	 * @brief Returns the buffer data.
+	 * 
+	 * @return Buffer data
+	 */
+	[[nodiscard]] constexpr std::span<const std::byte> data() const noexcept
+	{
+		return std::span(bytes_).first(size_);
+	}
+
+	/**
+	 * @brief Returns the size of the buffer data.
+	 * 
+	 * @return Buffer data size
+	 */
+	[[nodiscard]] constexpr BufferSize size() const noexcept
+	{
+		return size_;
+	}
+
+	/**
+	 * @brief Returns the fixed capacity of the buffer.
+	 * 
+	 * @return Capacity
+	 */
+	[[nodiscard]] static constexpr BufferSize capacity() noexcept
+	{
+		return N;
+	}
+
+	/**
+	 * @brief Checks if the buffer is empty.
+	 * 
+	 * @return `True` if the buffer is empty, otherwise `false`
+	 */
+	[[nodiscard]] constexpr bool empty() const noexcept
+	{
+		return !size_;
+	}
+
+	/**
+	 * @brief Removes all data from the buffer.
+	 */
+	constexpr void clear() noexcept
+	{
+		size_ = 0;
+	}
+
+	/**
+	 * @brief Compares the data of two buffers.
+	 * 
+	 * @return `True` if the buffers hold equal data, otherwise `false`
+	 */
+	[[nodiscard]] friend constexpr bool operator==(const StaticBuffer& lhs, const StaticBuffer& rhs) noexcept
+	{
+		return std::ranges::equal(lhs.data(), rhs.data());
+	}
+
+private:
+	using SizeType = detail::StaticBufferSize<N>;
+
+	static constexpr void checkCapacity(std::size_t size, std::size_t addedSize)
+	{
+		if (addedSize > N - size)
+		{
+			throw std::length_error("static buffer size exceeds its capacity");
+		}
+	}
+
+	std::array<std::byte, N> bytes_{};
+	SizeType size_{};
+};
+
+static_assert(BufferLike<StaticBuffer<16>>);
+} // namespace byte_buffer
+
+#endif // INCLUDE_BYTE_BUFFER_STATIC_BUFFER_HPP
@@ -0,0 +1,301 @@
+#include <array>
+#include <cerrno>
+#include <sys/epoll.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+#include "../include/byte_buffer/async_io.hpp"
+
+namespace byte_buffer
+{
+namespace
+{
+constexpr int maxEvents{64};
+
+thread_local EventLoop* runningLoop{};
+
+// makes the loop the target of operations started by the tasks it resumes
+class RunningLoopScope final
+{
+public:
+	explicit RunningLoopScope(EventLoop& loop) noexcept : previous_{std::exchange(runningLoop, &loop)} {}
+
+	RunningLoopScope(const RunningLoopScope&) = delete;
+	RunningLoopScope& operator=(const RunningLoopScope&) = delete;
+
+	~RunningLoopScope()
+	{
+		runningLoop = previous_;
+	}
+
+private:
+	EventLoop* previous_;
+};
+
+[[noreturn]] void throwSystemError(int error, const char* what)
+{
+	throw std::system_error(error, std::generic_category(), what);
+}
+
+bool wouldBlock(int error) noexcept
+{
+	return error == EAGAIN || error == EWOULDBLOCK;
+}
+} // namespace
+
+namespace detail
+{
+IoOperation::IoOperation(EventLoop& loop, int fd, uint32_t events) noexcept
+	: fd_{fd}, loop_{loop}, events_{events}, error_{}, failedCall_{}
+{
+}
+
+bool IoOperation::await_ready() noexcept
+{
+	// regular files are never reported as would block, so their operations complete here
+	return perform();
+}
+
+bool IoOperation::await_suspend(std::coroutine_handle<> continuation) noexcept
+{
+	continuation_ = continuation;
+	return loop_.wait(*this);
+}
+
+bool IoOperation::fail(int error, const char* call) noexcept
+{
+	error_ = error;
+	failedCall_ = call;
+
+	return true;
+}
+
+void IoOperation::throwIfFailed() const
+{
+	if (error_)
+	{
+		throwSystemError(error_, failedCall_);
+	}
+}
+} // namespace detail
+
+struct EventLoop::Detached
+{
+	struct promise_type
+	{
+		Detached get_return_object() const noexcept
+		{
+			return {};
+		}
+
+		std::suspend_never initial_suspend() const noexcept
+		{
+			return {};
+		}
+
+		std::suspend_never final_suspend() const noexcept
+		{
+			return {};
+		}
+
+		void return_void() const noexcept {}
+
+		void unhandled_exception() const noexcept
+		{
+			std::terminate();
+		}
+	};
+};
+
+EventLoop::EventLoop() : epollFd_{::epoll_create1(EPOLL_CLOEXEC)}, pendingTasks_{}, waitingOperations_{}
+{
+	if (epollFd_ == -1)
+	{
+		throwSystemError(errno, "epoll_create1");
+	}
+}
+
+EventLoop::~EventLoop()
+{
+	::close(epollFd_);
+}
+
+void EventLoop::spawn(Task<void> task)
+{
+	const RunningLoopScope scope(*this);
+
+	++pendingTasks_;
+	runDetached(*this, std::move(task));
+}
+
+void EventLoop::run()
+{
+	const RunningLoopScope scope(*this);
+	std::array<epoll_event, maxEvents> events;
+
+	// a task suspended on anything but an operation of this loop cannot be resumed by it
+	while (pendingTasks_ && waitingOperations_)
+	{
+		const auto count{::epoll_wait(epollFd_, events.data(), maxEvents, -1)};
+
+		if (count == -1 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (count == -1)
+		{
+			throwSystemError(errno, "epoll_wait");
+		}
+
+		for (int i{}; i < count; ++i)
+		{
+			auto& operation{*static_cast<detail::IoOperation*>(events[i].data.ptr)};
+
+			::epoll_ctl(epollFd_, EPOLL_CTL_DEL, operation.fd_, nullptr);
+			--waitingOperations_;
+
+			// the operation lives in the coroutine frame, it must not be touched after resuming
+			if (operation.perform() || !wait(operation))
+			{
+				operation.continuation_.resume();
+			}
+		}
+	}
+
+	if (exception_)
+	{
+		std::rethrow_exception(std::exchange(exception_, nullptr));
+	}
+}
+
+EventLoop::Detached EventLoop::runDetached(EventLoop& loop, Task<void> task)
+{
+	try
+	{
+		co_await task;
+	}
+	catch (...)
+	{
+		if (!loop.exception_)
+		{
+			loop.exception_ = std::current_exception();
+		}
+	}
+
+	--loop.pendingTasks_;
+}
+
+bool EventLoop::wait(detail::IoOperation& operation) noexcept
+{
+	epoll_event event{};
+	event.events = operation.events_ | EPOLLONESHOT;
+	event.data.ptr = &operation;
+
+	if (::epoll_ctl(epollFd_, EPOLL_CTL_ADD, operation.fd_, &event) == -1)
+	{
+		operation.fail(errno, "epoll_ctl");
+		return false;
+	}
+
+	++waitingOperations_;
+
+	return true;
+}
+
+EventLoop& thread_event_loop()
+{
+	if (runningLoop)
+	{
+		return *runningLoop;
+	}
+
+	thread_local EventLoop loop;
+	return loop;
+}
+
+AppendOperation::AppendOperation(EventLoop& loop, Buffer& buffer, int fd, BufferSize size) noexcept
+	: IoOperation(loop, fd, EPOLLIN), buffer_{buffer}, size_{size}, bytesRead_{}
+{
+}
+
+bool AppendOperation::perform() noexcept
+{
+	while (bytesRead_ < size_)
+	{
+		const auto result{::read(fd_, buffer_.data_ + buffer_.dataSize_, size_ - bytesRead_)};
+
+		if (result == -1 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (result == -1)
+		{
+			return wouldBlock(errno) ? false : fail(errno, "read");
+		}
+
+		if (result == 0)
+		{
+			break;
+		}
+
+		bytesRead_ += result;
+		buffer_.dataSize_ += result;
+	}
+
+	return true;
+}
+
+BufferSize AppendOperation::await_resume() const
+{
+	throwIfFailed();
+	return bytesRead_;
+}
+
+WriteOperation::WriteOperation(EventLoop& loop, const Buffer& buffer, int fd) noexcept
+	: IoOperation(loop, fd, EPOLLOUT), buffer_{buffer}, bytesWritten_{}
+{
+}
+
+bool WriteOperation::perform() noexcept
+{
+	const auto data{buffer_.data()};
+
+	while (bytesWritten_ < data.size())
+	{
+		const auto result{::write(fd_, data.data() + bytesWritten_, data.size() - bytesWritten_)};
+
+		if (result == -1 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (result == -1)
+		{
+			return wouldBlock(errno) ? false : fail(errno, "write");
+		}
+
+		bytesWritten_ += result;
+	}
+
+	return true;
+}
+
+void WriteOperation::await_resume() const
+{
+	throwIfFailed();
+}
+
+AppendOperation Buffer::async_append(int fd, BufferSize size)
+{
+	grow(size);
+	return AppendOperation(thread_event_loop(), *this, fd, size);
+}
+
+WriteOperation Buffer::async_write(int fd) const
+{
+	return WriteOperation(thread_event_loop(), *this, fd);
+}
+} // namespace byte_buffer
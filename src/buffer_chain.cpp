@@ -0,0 +1,100 @@
+#include "../include/byte_buffer/buffer_chain.hpp"
+
+namespace byte_buffer
+{
+void BufferChain::append(Buffer&& segment)
+{
+	size_ += segment.size();
+	segments_.push_back(std::move(segment));
+}
+
+void BufferChain::prepend(Buffer&& segment)
+{
+	size_ += segment.size();
+	segments_.push_front(std::move(segment));
+}
+
+const std::deque<Buffer>& BufferChain::segments() const noexcept
+{
+	return segments_;
+}
+
+std::vector<iovec> BufferChain::iovecs() const
+{
+	std::vector<iovec> iov;
+	iov.reserve(segments_.size());
+
+	for (const auto& segment : segments_)
+	{
+		if (!segment.empty())
+		{
+			iov.push_back({const_cast<std::byte*>(segment.data().data()), segment.size()});
+		}
+	}
+
+	return iov;
+}
+
+void BufferChain::write_to(int fd) const
+{
+	std::vector<const Buffer*> buffers;
+	buffers.reserve(segments_.size());
+
+	for (const auto& segment : segments_)
+	{
+		buffers.push_back(&segment);
+	}
+
+	Buffer::write_to(fd, buffers);
+}
+
+const Buffer& BufferChain::flatten()
+{
+	if (segments_.empty())
+	{
+		segments_.emplace_back();
+	}
+
+	if (segments_.size() > 1)
+	{
+		// the first segment is reused, so its free space may save the reallocation
+		auto& flat{segments_.front()};
+		const auto flatSize{flat.size()};
+		flat.reserve(size_);
+
+		try
+		{
+			for (auto segment{segments_.begin() + 1}; segment != segments_.end(); ++segment)
+			{
+				flat.append(segment->data());
+			}
+		}
+		catch (...)
+		{
+			// the segments are kept, so the chain stays unchanged
+			flat.resize_uninitialized(flatSize);
+			throw;
+		}
+
+		segments_.erase(segments_.begin() + 1, segments_.end());
+	}
+
+	return segments_.front();
+}
+
+BufferSize BufferChain::size() const noexcept
+{
+	return size_;
+}
+
+bool BufferChain::empty() const noexcept
+{
+	return size_ == 0;
+}
+
+void BufferChain::clear() noexcept
+{
+	segments_.clear();
+	size_ = 0;
+}
+} // namespace byte_buffer
@@ -0,0 +1,358 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+
+#include "../include/byte_buffer/buffer_log.hpp"
+#include "../include/byte_buffer/kernels.hpp"
+
+namespace byte_buffer
+{
+namespace
+{
+constexpr char magic[]{"BUFLOG01"};
+constexpr std::size_t headerSize{sizeof(magic) - 1};
+
+[[noreturn]] void throwSystemError(int error, const char* what)
+{
+	throw std::system_error(error, std::generic_category(), what);
+}
+
+// opens the file, `created` tells whether this call created it
+int openFile(const std::filesystem::path& path, bool& created)
+{
+	for (;;)
+	{
+		if (const auto fd{::open(path.c_str(), O_RDWR | O_CLOEXEC)}; fd != -1 || errno != ENOENT)
+		{
+			created = false;
+			return fd;
+		}
+
+		// another process may create the file in between, then it is opened again
+		if (const auto fd{::open(path.c_str(), O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644)}; fd != -1 || errno != EEXIST)
+		{
+			created = fd != -1;
+			return fd;
+		}
+	}
+}
+
+// makes the directory entry of a new file durable
+void syncDirectory(const std::filesystem::path& path)
+{
+	const auto directory{path.has_parent_path() ? path.parent_path() : std::filesystem::path(".")};
+	const auto fd{::open(directory.c_str(), O_RDONLY | O_DIRECTORY | O_CLOEXEC)};
+
+	if (fd == -1)
+	{
+		throwSystemError(errno, "open");
+	}
+
+	const auto result{::fsync(fd)};
+	const auto error{errno};
+	::close(fd);
+
+	if (result == -1)
+	{
+		throwSystemError(error, "fsync");
+	}
+}
+
+std::size_t pageSize() noexcept
+{
+	static const auto size{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+	return size;
+}
+
+std::size_t roundUp(std::size_t size, std::size_t step) noexcept
+{
+	return (size + step - 1) / step * step;
+}
+
+// the payload is padded to 8 bytes, so record headers stay aligned
+constexpr uint64_t recordSize(uint64_t payloadSize) noexcept
+{
+	return BufferLog::recordHeaderSize + (payloadSize + 7) / 8 * 8;
+}
+
+// the size is covered too, so a corrupted size cannot pass as a shorter or longer record
+uint32_t recordCrc(uint32_t size, std::span<const std::byte> payload) noexcept
+{
+	return kernels::crc32c(payload, kernels::crc32c(std::as_bytes(std::span(&size, 1))));
+}
+} // namespace
+
+BufferLog::Iterator::Iterator(const std::byte* record) noexcept : record_{record} {}
+
+BufferLog::Iterator::value_type BufferLog::Iterator::operator*() const noexcept
+{
+	uint32_t size;
+	std::memcpy(&size, record_, sizeof(size));
+
+	return {record_ + recordHeaderSize, size};
+}
+
+BufferLog::Iterator& BufferLog::Iterator::operator++() noexcept
+{
+	uint32_t size;
+	std::memcpy(&size, record_, sizeof(size));
+	record_ += recordSize(size);
+
+	return *this;
+}
+
+BufferLog::Iterator BufferLog::Iterator::operator++(int) noexcept
+{
+	auto iterator{*this};
+	++*this;
+
+	return iterator;
+}
+
+BufferLog::BufferLog(const std::filesystem::path& path, std::size_t maxSize)
+	: fd_{-1}, mapping_{}, maxSize_{roundUp(std::max(maxSize, growthStep), growthStep)}, capacity_{}, size_{}, syncedSize_{}, syncing_{}
+{
+	auto created{false};
+	fd_ = openFile(path, created);
+
+	if (fd_ == -1)
+	{
+		throwSystemError(errno, "open");
+	}
+
+	try
+	{
+		struct stat fileStat{};
+
+		if (::fstat(fd_, &fileStat) == -1)
+		{
+			throwSystemError(errno, "fstat");
+		}
+
+		const auto fileSize{static_cast<std::size_t>(fileStat.st_size)};
+
+		if (fileSize > maxSize_)
+		{
+			throw std::length_error("buffer log exceeds its maximum size");
+		}
+
+		// the whole range is reserved up front, so growing the file never moves the mapping
+		const auto reserved{::mmap(nullptr, maxSize_, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0)};
+
+		if (reserved == MAP_FAILED)
+		{
+			throwSystemError(errno, "mmap");
+		}
+
+		mapping_ = static_cast<std::byte*>(reserved);
+		recover(fileSize);
+
+		// otherwise the file itself may be lost in a crash, taking the synced records with it
+		if (created)
+		{
+			syncDirectory(path);
+		}
+	}
+	catch (...)
+	{
+		destroy();
+		throw;
+	}
+}
+
+BufferLog::~BufferLog()
+{
+	destroy();
+}
+
+uint64_t BufferLog::append(std::span<const std::byte> payload)
+{
+	if (payload.size() > maxPayloadSize)
+	{
+		throw std::length_error("buffer log record exceeds the maximum payload size");
+	}
+
+	const auto size{static_cast<uint32_t>(payload.size())};
+	const auto crc{recordCrc(size, payload)};
+
+	const std::lock_guard lock(mutex_);
+	const auto end{size_ + recordSize(size)};
+	grow(end);
+
+	// the space behind the log is zero, which provides the padding
+	const auto record{mapping_ + size_};
+	std::memcpy(record, &size, sizeof(size));
+	std::memcpy(record + sizeof(size), &crc, sizeof(crc));
+
+	if (size)
+	{
+		std::memcpy(record + recordHeaderSize, payload.data(), size);
+	}
+
+	size_ = end;
+
+	return end;
+}
+
+void BufferLog::sync(uint64_t position)
+{
+	std::unique_lock lock(mutex_);
+	position = std::min(position, size_);
+
+	while (syncedSize_ < position)
+	{
+		if (syncing_)
+		{
+			synced_.wait(lock);
+			continue;
+		}
+
+		// the leader flushes everything appended so far, the records of the waiting threads included
+		syncing_ = true;
+		const auto from{syncedSize_ / pageSize() * pageSize()};
+		const auto to{size_};
+
+		lock.unlock();
+		const auto result{::msync(mapping_ + from, to - from, MS_SYNC)};
+		const auto error{errno};
+		lock.lock();
+
+		syncing_ = false;
+		synced_.notify_all();
+
+		if (result == -1)
+		{
+			throwSystemError(error, "msync");
+		}
+
+		syncedSize_ = to;
+	}
+}
+
+void BufferLog::sync()
+{
+	sync(std::numeric_limits<uint64_t>::max());
+}
+
+BufferLog::Iterator BufferLog::begin() const noexcept
+{
+	return Iterator(mapping_ + headerSize);
+}
+
+BufferLog::Iterator BufferLog::end() const noexcept
+{
+	const std::lock_guard lock(mutex_);
+	return Iterator(mapping_ + size_);
+}
+
+uint64_t BufferLog::size() const noexcept
+{
+	const std::lock_guard lock(mutex_);
+	return size_;
+}
+
+void BufferLog::recover(std::size_t fileSize)
+{
+	if (fileSize && ::mmap(mapping_, roundUp(fileSize, pageSize()), PROT_READ, MAP_SHARED | MAP_FIXED, fd_, 0) == MAP_FAILED)
+	{
+		throwSystemError(errno, "mmap");
+	}
+
+	const auto header{std::span<const std::byte>(mapping_, std::min(fileSize, headerSize))};
+	const auto initialized{header.size() == headerSize && std::memcmp(header.data(), magic, headerSize) == 0};
+
+	// a log torn while being created is zero up to its first growth step
+	if (!initialized && (fileSize > growthStep ||
+		std::ranges::any_of(std::span<const std::byte>(mapping_, fileSize), [](std::byte byte) { return byte != std::byte{}; })))
+	{
+		throw std::runtime_error("file is not a buffer log");
+	}
+
+	auto end{headerSize};
+
+	while (initialized && end + recordHeaderSize <= fileSize)
+	{
+		uint32_t size;
+		uint32_t crc;
+		std::memcpy(&size, mapping_ + end, sizeof(size));
+		std::memcpy(&crc, mapping_ + end + sizeof(size), sizeof(crc));
+
+		if (end + recordSize(size) > fileSize || recordCrc(size, {mapping_ + end + recordHeaderSize, size}) != crc)
+		{
+			break;
+		}
+
+		end += recordSize(size);
+	}
+
+	// the torn tail is cut off, so a later crash cannot bring back records behind newer ones
+	if (::ftruncate(fd_, static_cast<off_t>(end)) == -1)
+	{
+		throwSystemError(errno, "ftruncate");
+	}
+
+	grow(end);
+
+	if (!initialized)
+	{
+		std::memcpy(mapping_, magic, headerSize);
+	}
+
+	if (::fdatasync(fd_) == -1)
+	{
+		throwSystemError(errno, "fdatasync");
+	}
+
+	size_ = end;
+	syncedSize_ = end;
+}
+
+void BufferLog::grow(std::size_t size)
+{
+	if (size <= capacity_)
+	{
+		return;
+	}
+
+	if (size > maxSize_)
+	{
+		throw std::length_error("buffer log exceeds its maximum size");
+	}
+
+	const auto capacity{std::min(maxSize_, std::max(roundUp(size, growthStep), capacity_ * 2))};
+
+	// the blocks are allocated up front, so a full disk fails here instead of faulting on a write to the mapping
+	if (const auto error{::posix_fallocate(fd_, static_cast<off_t>(capacity_), static_cast<off_t>(capacity - capacity_))})
+	{
+		throwSystemError(error, "posix_fallocate");
+	}
+
+	if (::mmap(mapping_ + capacity_, capacity - capacity_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd_, static_cast<off_t>(capacity_)) == MAP_FAILED)
+	{
+		throwSystemError(errno, "mmap");
+	}
+
+	capacity_ = capacity;
+}
+
+void BufferLog::destroy() noexcept
+{
+	if (mapping_)
+	{
+		::munmap(mapping_, maxSize_);
+		mapping_ = nullptr;
+	}
+
+	if (fd_ != -1)
+	{
+		::close(fd_);
+		fd_ = -1;
+	}
+}
+} // namespace byte_buffer
@@ -0,0 +1,191 @@
+#include <new>
+#include <utility>
+
+#include "../include/byte_buffer/buffer_pool.hpp"
+
+namespace byte_buffer
+{
+namespace
+{
+constexpr auto minClassWidth{std::bit_width(BufferPool::minPooledCapacity)};
+
+// smallest class whose buffers hold the capacity
+std::size_t acquireClass(BufferSize capacity) noexcept
+{
+	const auto width{std::bit_width(capacity - 1)};
+	return width < minClassWidth ? 0 : static_cast<std::size_t>(width - minClassWidth + 1);
+}
+
+// largest class whose capacity the buffer holds
+std::size_t recycleClass(BufferSize capacity) noexcept
+{
+	return static_cast<std::size_t>(std::bit_width(capacity) - minClassWidth);
+}
+
+BufferSize classCapacity(std::size_t index) noexcept
+{
+	return BufferPool::minPooledCapacity << index;
+}
+} // namespace
+
+BufferPool::Handle::Handle() noexcept : pool_{}, buffer_{} {}
+
+BufferPool::Handle::Handle(BufferPool* pool, Buffer&& buffer) noexcept : pool_{pool}, buffer_{std::move(buffer)} {}
+
+BufferPool::Handle::Handle(Handle&& obj) noexcept : pool_{std::exchange(obj.pool_, nullptr)}, buffer_{std::move(obj.buffer_)} {}
+
+BufferPool::Handle& BufferPool::Handle::operator=(Handle&& obj)
+{
+	if (this != &obj)
+	{
+		recycle();
+		pool_ = std::exchange(obj.pool_, nullptr);
+		buffer_ = std::move(obj.buffer_);
+	}
+
+	return *this;
+}
+
+BufferPool::Handle::~Handle()
+{
+	recycle();
+}
+
+Buffer& BufferPool::Handle::operator*() noexcept
+{
+	return buffer_;
+}
+
+const Buffer& BufferPool::Handle::operator*() const noexcept
+{
+	return buffer_;
+}
+
+Buffer* BufferPool::Handle::operator->() noexcept
+{
+	return &buffer_;
+}
+
+const Buffer* BufferPool::Handle::operator->() const noexcept
+{
+	return &buffer_;
+}
+
+Buffer BufferPool::Handle::release() noexcept
+{
+	pool_ = nullptr;
+	return std::move(buffer_);
+}
+
+void BufferPool::Handle::recycle() noexcept
+{
+	if (pool_)
+	{
+		std::exchange(pool_, nullptr)->recycle(std::move(buffer_));
+	}
+}
+
+BufferPool::BufferPool(std::size_t maxRetainedBytes, std::pmr::memory_resource* resource) noexcept
+	: freeLists_{}, maxRetainedBytes_{maxRetainedBytes}, resource_{resource}, stats_{}
+{
+}
+
+BufferPool::Handle BufferPool::acquire(BufferSize capacity)
+{
+	// small buffers use the inline storage and need no recycling
+	if (capacity <= Buffer::inlineCapacity)
+	{
+		++stats_.hits;
+		return Handle(this, Buffer(resource_));
+	}
+
+	if (capacity <= maxPooledCapacity)
+	{
+		const auto index{acquireClass(capacity)};
+		auto& freeList{freeLists_[index]};
+
+		if (!freeList.empty())
+		{
+			Buffer buffer(std::move(freeList.back()));
+			freeList.pop_back();
+
+			stats_.retainedBytes -= buffer.capacity();
+			++stats_.hits;
+
+			return Handle(this, std::move(buffer));
+		}
+
+		capacity = classCapacity(index);
+	}
+
+	++stats_.misses;
+
+	Buffer buffer(resource_);
+	buffer.reserve(capacity);
+
+	return Handle(this, std::move(buffer));
+}
+
+void BufferPool::trim() noexcept
+{
+	for (auto& freeList : freeLists_)
+	{
+		freeList.clear();
+	}
+
+	stats_.retainedBytes = 0;
+}
+
+void BufferPool::set_max_retained_bytes(std::size_t maxRetainedBytes) noexcept
+{
+	maxRetainedBytes_ = maxRetainedBytes;
+
+	// the largest buffers are freed first
+	for (auto index{classCount}; index-- > 0 && stats_.retainedBytes > maxRetainedBytes_;)
+	{
+		auto& freeList{freeLists_[index]};
+
+		while (!freeList.empty() && stats_.retainedBytes > maxRetainedBytes_)
+		{
+			stats_.retainedBytes -= freeList.back().capacity();
+			freeList.pop_back();
+		}
+	}
+}
+
+BufferPoolStats BufferPool::stats() const noexcept
+{
+	return stats_;
+}
+
+void BufferPool::recycle(Buffer&& buffer) noexcept
+{
+	const auto capacity{buffer.capacity()};
+
+	if (capacity < minPooledCapacity || capacity > maxPooledCapacity || !buffer.resource()->is_equal(*resource_)
+		|| buffer.alignment() != Buffer::defaultAlignment || stats_.retainedBytes + capacity > maxRetainedBytes_)
+	{
+		return;
+	}
+
+	buffer.set_trim_policy({});
+	buffer.clear();
+	buffer.set_growth_policy(GrowthPolicy::exact);
+
+	try
+	{
+		freeLists_[recycleClass(capacity)].push_back(std::move(buffer));
+		stats_.retainedBytes += capacity;
+	}
+	catch (const std::bad_alloc&)
+	{
+		// the buffer is freed by its owner instead of being retained
+	}
+}
+
+BufferPool& thread_buffer_pool()
+{
+	thread_local BufferPool pool;
+	return pool;
+}
+} // namespace byte_buffer
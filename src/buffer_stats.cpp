@@ -0,0 +1,58 @@
+#include <algorithm>
+#include <bit>
+
+#include "../include/byte_buffer/buffer_stats.hpp"
+
+namespace byte_buffer
+{
+namespace
+{
+BufferStats& threadStats() noexcept
+{
+	thread_local BufferStats stats{};
+	return stats;
+}
+} // namespace
+
+BufferStats thread_buffer_stats() noexcept
+{
+	return threadStats();
+}
+
+void reset_thread_buffer_stats() noexcept
+{
+	threadStats() = {};
+}
+
+namespace detail
+{
+void count_allocation(std::size_t capacity) noexcept
+{
+	auto& stats{threadStats()};
+
+	++stats.allocations;
+	++stats.allocationSizes[std::bit_width(capacity)];
+	stats.liveCapacity += static_cast<int64_t>(capacity);
+	stats.peakCapacity = std::max(stats.peakCapacity, stats.liveCapacity);
+}
+
+void count_free(std::size_t capacity, std::size_t size) noexcept
+{
+	auto& stats{threadStats()};
+
+	++stats.frees;
+	stats.wastedBytes += capacity - size;
+	stats.liveCapacity -= static_cast<int64_t>(capacity);
+}
+
+void count_reallocation() noexcept
+{
+	++threadStats().reallocations;
+}
+
+void count_copy(std::size_t size) noexcept
+{
+	threadStats().bytesCopied += size;
+}
+} // namespace detail
+} // namespace byte_buffer
@@ -1,26 +1,42 @@
+#include <algorithm>
+#include <bit>
 #include <cstring>
+#include <functional>
+#include <limits>
+#include <stdexcept>
 
+#include "../include/byte_buffer/buffer_stats.hpp"
 #include "../include/byte_buffer/byte_buffer.hpp"
+#include "../include/byte_buffer/parallel.hpp"
 
 namespace byte_buffer
 {
-Buffer::Buffer() noexcept : data_{}, dataSize_{}, capacity_{} {}
+Buffer::Buffer() noexcept : Buffer(GrowthPolicy::exact) {}
 
-Buffer::Buffer(std::span<const std::byte> data) : data_{}, dataSize_{}, capacity_{}
+Buffer::Buffer(std::pmr::memory_resource* resource) noexcept : Buffer(GrowthPolicy::exact, resource) {}
+
+Buffer::Buffer(GrowthPolicy growthPolicy, std::pmr::memory_resource* resource) noexcept
+	: data_{}, dataSize_{}, capacity_{}, growthPolicy_{growthPolicy}, alignmentShift_{static_cast<uint8_t>(std::countr_zero(defaultAlignment))},
+	  trimPolicy_{}, lowUtilizationClears_{}, resource_{resource}
+{
+}
+
+Buffer::Buffer(std::span<const std::byte> data, std::pmr::memory_resource* resource) : Buffer(GrowthPolicy::exact, resource)
 {
 	copy(data, false);
 }
 
-Buffer::Buffer(const Buffer& obj) : data_{}, dataSize_{}, capacity_{}
+Buffer::Buffer(const Buffer& obj) : Buffer(obj.growthPolicy_)
 {
+	alignmentShift_ = obj.alignmentShift_;
+	trimPolicy_ = obj.trimPolicy_;
 	copy(obj.data(), false);
 }
 
-Buffer::Buffer(Buffer&& obj) : data_{}, dataSize_{}, capacity_{}
+Buffer::Buffer(Buffer&& obj) noexcept : Buffer(obj.growthPolicy_, obj.resource_)
 {
-	std::swap(data_, obj.data_);
-	std::swap(dataSize_, obj.dataSize_);
-	std::swap(capacity_, obj.capacity_);
+	trimPolicy_ = obj.trimPolicy_;
+	steal(obj);
 }
 
 Buffer& Buffer::operator=(const Buffer& obj)
@@ -28,6 +44,8 @@ Buffer& Buffer::operator=(const Buffer& obj)
 	if (this != &obj)
 	{
 		copy(obj.data(), false);
+		growthPolicy_ = obj.growthPolicy_;
+		trimPolicy_ = obj.trimPolicy_;
 	}
 
 	return *this;
@@ -37,11 +55,20 @@ Buffer& Buffer::operator=(Buffer&& obj)
 {
 	if (this != &obj)
 	{
-		destroy();
+		if (obj.isInline() || resource_->is_equal(*obj.resource_))
+		{
+			destroy();
+			steal(obj);
+		}
+		else
+		{
+			// storage allocated from another resource cannot be adopted, so its data is copied
+			copy(obj.data(), false);
+			obj.destroy();
+		}
 
-		std::swap(data_, obj.data_);
-		std::swap(dataSize_, obj.dataSize_);
-		std::swap(capacity_, obj.capacity_);
+		growthPolicy_ = obj.growthPolicy_;
+		trimPolicy_ = obj.trimPolicy_;
 	}
 
 	return *this;
@@ -52,7 +79,7 @@ Buffer::~Buffer()
 	destroy();
 }
 
-void Buffer::reserve(uint32_t capacity)
+void Buffer::reserve(BufferSize capacity)
 {
 	if (capacity_ < capacity)
 	{
@@ -65,14 +92,14 @@ void Buffer::overwrite(std::span<const std::byte> bytes)
 	copy(bytes, false);
 }
 
-void Buffer::overwrite(std::ifstream& file, uint32_t size)
+void Buffer::overwrite(std::ifstream& file, BufferSize size)
 {
 	if (capacity_ < size)
 	{
 		reallocate(size, false);
 	}
 
-	dataSize_ = file.read(reinterpret_cast<char*>(data_), size).gcount();
+	dataSize_ = static_cast<BufferSize>(file.read(reinterpret_cast<char*>(data_), size).gcount());
 }
 
 void Buffer::append(std::span<const std::byte> bytes)
@@ -80,14 +107,38 @@ void Buffer::append(std::span<const std::byte> bytes)
 	copy(bytes, true);
 }
 
-void Buffer::append(std::ifstream& file, uint32_t size)
+void Buffer::append(std::ifstream& file, BufferSize size)
+{
+	grow(size);
+
+	dataSize_ += static_cast<BufferSize>(file.read(reinterpret_cast<char*>(data_ + dataSize_), size).gcount());
+}
+
+void Buffer::resize_uninitialized(BufferSize size)
+{
+	if (capacity_ < size)
+	{
+		reallocate(size, true);
+	}
+
+	dataSize_ = size;
+}
+
+std::span<std::byte> Buffer::prepare(BufferSize size)
+{
+	grow(size);
+
+	return {data_ + dataSize_, size};
+}
+
+void Buffer::commit(BufferSize size)
 {
-	if (capacity_ - dataSize_ < size)
+	if (size > capacity_ - dataSize_)
 	{
-		reallocate(dataSize_ + size, true);
+		throw std::out_of_range("committed size exceeds the buffer free space");
 	}
 
-	dataSize_ += file.read(reinterpret_cast<char*>(data_ + dataSize_), size).gcount();
+	dataSize_ += size;
 }
 
 std::span<const std::byte> Buffer::data() const noexcept
@@ -95,12 +146,12 @@ std::span<const std::byte> Buffer::data() const noexcept
 	return {data_, dataSize_};
 }
 
-uint32_t Buffer::size() const noexcept
+BufferSize Buffer::size() const noexcept
 {
 	return dataSize_;
 }
 
-uint32_t Buffer::capacity() const noexcept
+BufferSize Buffer::capacity() const noexcept
 {
 	return capacity_;
 }
@@ -112,14 +163,143 @@ bool Buffer::empty() const noexcept
 
 void Buffer::clear()
 {
+	if (trimPolicy_.clears && data_ && !isInline())
+	{
+		const auto lowUtilization{uint64_t{dataSize_} * 100 < uint64_t{capacity_} * trimPolicy_.utilizationPercent};
+		lowUtilizationClears_ = lowUtilization ? static_cast<uint8_t>(lowUtilizationClears_ + 1) : 0;
+
+		if (lowUtilizationClears_ >= trimPolicy_.clears)
+		{
+			lowUtilizationClears_ = 0;
+			destroy();
+		}
+	}
+
+	dataSize_ = 0;
+}
+
+void Buffer::shrink_to_fit()
+{
+	if (capacity_ > dataSize_)
+	{
+		reallocate(dataSize_, true);
+	}
+}
+
+BufferStorage Buffer::release()
+{
+	if (isInline())
+	{
+		// inline data cannot leave the buffer object, so it is moved to the heap
+		const auto data{static_cast<std::byte*>(resource_->allocate(inlineCapacity, alignment()))};
+		std::memcpy(data, inlineData_, dataSize_);
+		data_ = data;
+		capacity_ = inlineCapacity;
+
+		if constexpr (buffer_stats_enabled)
+		{
+			detail::count_allocation(capacity_);
+			detail::count_copy(dataSize_);
+		}
+	}
+
+	if constexpr (buffer_stats_enabled)
+	{
+		// the storage is no longer accounted for once the caller owns it
+		if (data_)
+		{
+			detail::count_free(capacity_, dataSize_);
+		}
+	}
+
+	const BufferStorage storage{data_, dataSize_, capacity_, alignment(), resource_};
+
+	data_ = nullptr;
 	dataSize_ = 0;
+	capacity_ = 0;
+
+	return storage;
+}
+
+void Buffer::set_trim_policy(TrimPolicy trimPolicy) noexcept
+{
+	trimPolicy_ = trimPolicy;
+	lowUtilizationClears_ = 0;
+}
+
+TrimPolicy Buffer::trim_policy() const noexcept
+{
+	return trimPolicy_;
+}
+
+void Buffer::set_alignment(std::size_t alignment)
+{
+	if (!std::has_single_bit(alignment))
+	{
+		throw std::invalid_argument("alignment must be a power of two");
+	}
+
+	alignment = std::max(alignment, defaultAlignment);
+
+	if (alignment == this->alignment())
+	{
+		return;
+	}
+
+	// the storage is deallocated with the alignment it was allocated with, so it is moved to a new allocation
+	Buffer aligned(growthPolicy_, resource_);
+	aligned.alignmentShift_ = static_cast<uint8_t>(std::countr_zero(alignment));
+
+	if (capacity_)
+	{
+		aligned.reallocate(capacity_, false);
+		aligned.dataSize_ = dataSize_;
+
+		if (dataSize_)
+		{
+			detail::copy_bytes(aligned.data_, data_, dataSize_);
+
+			if constexpr (buffer_stats_enabled)
+			{
+				detail::count_copy(dataSize_);
+			}
+		}
+	}
+
+	destroy();
+	steal(aligned);
+}
+
+std::size_t Buffer::alignment() const noexcept
+{
+	return std::size_t{1} << alignmentShift_;
+}
+
+void Buffer::set_growth_policy(GrowthPolicy growthPolicy) noexcept
+{
+	growthPolicy_ = growthPolicy;
+}
+
+GrowthPolicy Buffer::growth_policy() const noexcept
+{
+	return growthPolicy_;
+}
+
+std::pmr::memory_resource* Buffer::resource() const noexcept
+{
+	return resource_;
 }
 
 void Buffer::destroy()
 {
-	if (data_)
+	if (data_ && !isInline())
 	{
-		delete[] data_;
+		if constexpr (buffer_stats_enabled)
+		{
+			detail::count_free(capacity_, dataSize_);
+		}
+
+		resource_->deallocate(data_, capacity_, alignment());
 	}
 
 	data_ = nullptr;
@@ -127,40 +307,181 @@ void Buffer::destroy()
 	dataSize_ = 0;
 }
 
-void Buffer::reallocate(uint32_t size, bool saveExistingData)
+void Buffer::steal(Buffer& obj) noexcept
 {
-	capacity_ = size;
-	auto newData = new std::byte[capacity_];
-
-	if (saveExistingData)
+	if (obj.isInline())
 	{
-		dataSize_ = std::min(dataSize_, capacity_);
-		std::memcpy(newData, data_, dataSize_);
+		std::memcpy(inlineData_, obj.inlineData_, obj.dataSize_);
+		data_ = inlineData_;
 	}
 	else
 	{
-		dataSize_ = 0;
+		data_ = obj.data_;
+	}
+
+	dataSize_ = obj.dataSize_;
+	capacity_ = obj.capacity_;
+	alignmentShift_ = obj.alignmentShift_;
+
+	obj.data_ = nullptr;
+	obj.dataSize_ = 0;
+	obj.capacity_ = 0;
+}
+
+bool Buffer::isInline() const noexcept
+{
+	return data_ == inlineData_;
+}
+
+void Buffer::reallocate(BufferSize size, bool saveExistingData)
+{
+	// the data size changes only once the new storage exists, so a failed allocation leaves the buffer intact
+	const auto keptSize{saveExistingData ? std::min(dataSize_, size) : BufferSize{}};
+
+	// the inline storage cannot provide stricter alignment than the buffer object itself
+	const auto fitsInline{size <= inlineCapacity && alignment() <= defaultAlignment};
+
+	if (fitsInline && (!data_ || isInline()))
+	{
+		// the inline storage already holds the data, only the reported capacity changes
+		data_ = inlineData_;
+		capacity_ = size;
+		dataSize_ = keptSize;
+		return;
+	}
+
+	auto newData = fitsInline ? inlineData_ : static_cast<std::byte*>(resource_->allocate(size, alignment()));
+
+	if (keptSize)
+	{
+		detail::copy_bytes(newData, data_, keptSize);
+	}
+
+	if constexpr (buffer_stats_enabled)
+	{
+		if (!fitsInline)
+		{
+			detail::count_allocation(size);
+		}
+
+		if (capacity_ && size > capacity_)
+		{
+			detail::count_reallocation();
+		}
+
+		if (data_ && !isInline())
+		{
+			detail::count_free(capacity_, dataSize_);
+		}
+
+		detail::count_copy(keptSize);
+	}
+
+	if (data_ && !isInline())
+	{
+		resource_->deallocate(data_, capacity_, alignment());
 	}
 
-	delete[] data_;
 	data_ = newData;
+	capacity_ = size;
+	dataSize_ = keptSize;
 }
 
 void Buffer::copy(std::span<const std::byte> bytes, bool saveExistingData)
 {
-	const auto freeSpace{saveExistingData ? capacity_ - dataSize_ : capacity_};
+	const auto offset{saveExistingData ? dataSize_ : BufferSize{}};
 
-	if (freeSpace < bytes.size())
+	if (bytes.size() > std::numeric_limits<BufferSize>::max() - offset)
 	{
-		const auto newCapacity{saveExistingData ? dataSize_ + bytes.size() : bytes.size()};
-		reallocate(newCapacity, saveExistingData);
+		throw std::length_error("byte buffer size exceeds the maximum size");
 	}
-	else
+
+	const auto newSize{static_cast<BufferSize>(offset + bytes.size())};
+
+	// bytes taken from the buffer data itself are found at the same offset after a reallocation
+	const auto aliased{!bytes.empty() && std::less_equal<const std::byte*>{}(data_, bytes.data()) &&
+		std::less<const std::byte*>{}(bytes.data(), data_ + dataSize_)};
+	const auto aliasOffset{aliased ? bytes.data() - data_ : 0};
+
+	if (capacity_ < newSize)
+	{
+		reallocate(saveExistingData ? grownCapacity(newSize) : newSize, saveExistingData);
+
+		if (aliased)
+		{
+			bytes = {data_ + aliasOffset, bytes.size()};
+		}
+	}
+
+	if (!bytes.empty())
+	{
+		// overwriting the data with a part of itself copies between overlapping ranges
+		if (aliased && !saveExistingData)
+		{
+			std::memmove(data_, bytes.data(), bytes.size());
+		}
+		else
+		{
+			detail::copy_bytes(data_ + offset, bytes.data(), bytes.size());
+		}
+
+		if constexpr (buffer_stats_enabled)
+		{
+			detail::count_copy(bytes.size());
+		}
+	}
+
+	dataSize_ = newSize;
+}
+
+void Buffer::grow(BufferSize size)
+{
+	const auto newSize{requiredSize(size)};
+
+	if (capacity_ < newSize)
+	{
+		reallocate(grownCapacity(newSize), true);
+	}
+}
+
+BufferSize Buffer::requiredSize(std::size_t size) const
+{
+	if (size > std::numeric_limits<BufferSize>::max() - dataSize_)
+	{
+		throw std::length_error("byte buffer size exceeds the maximum size");
+	}
+
+	return dataSize_ + static_cast<BufferSize>(size);
+}
+
+BufferSize Buffer::grownCapacity(BufferSize requiredSize) const noexcept
+{
+	constexpr auto maxSize{std::numeric_limits<BufferSize>::max()};
+
+	// every policy saturates at the maximum size instead of wrapping around
+	const auto roundUp{[requiredSize](BufferSize granularity) {
+		return requiredSize > maxSize - (granularity - 1) ? maxSize : (requiredSize + granularity - 1) / granularity * granularity;
+	}};
+	auto newCapacity{requiredSize};
+
+	switch (growthPolicy_)
 	{
-		dataSize_ = saveExistingData ? dataSize_ : 0;
+		case GrowthPolicy::exact:
+			break;
+		case GrowthPolicy::geometric_1_5:
+			newCapacity = std::max(requiredSize, capacity_ > maxSize / 3 * 2 ? maxSize : capacity_ + capacity_ / 2);
+			break;
+		case GrowthPolicy::geometric_2:
+			newCapacity = std::max(requiredSize, capacity_ > maxSize / 2 ? maxSize : capacity_ * 2);
+			break;
+		case GrowthPolicy::page_rounded:
+			newCapacity = roundUp(pageSize);
+			break;
+		case GrowthPolicy::fixed_chunk:
+			newCapacity = roundUp(chunkSize);
+			break;
 	}
 
-	std::memcpy(data_ + dataSize_, bytes.data(), bytes.size());
-	dataSize_ += bytes.size();
+	return newCapacity;
 }
 } // namespace byte_buffer
@@ -0,0 +1,333 @@
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <limits>
+#include <sys/uio.h>
+#include <system_error>
+#include <unistd.h>
+#include <vector>
+
+#ifdef BYTE_BUFFER_WITH_IO_URING
+#include <liburing.h>
+#endif
+
+#include "../include/byte_buffer/byte_buffer.hpp"
+
+namespace byte_buffer
+{
+namespace
+{
+[[noreturn]] void throwSystemError(int error, const char* what)
+{
+	throw std::system_error(error, std::generic_category(), what);
+}
+
+// retries a system call interrupted by a signal
+template <typename SystemCall>
+ssize_t retry(SystemCall&& systemCall)
+{
+	ssize_t result;
+
+	do
+	{
+		result = systemCall();
+	} while (result == -1 && errno == EINTR);
+
+	return result;
+}
+
+// transfers the whole io vector, advancing it past partially transferred entries
+template <typename SystemCall>
+std::size_t transferAll(std::vector<iovec>& iov, bool stopAtEnd, const char* what, SystemCall&& systemCall)
+{
+	std::size_t transferred{};
+	auto first{iov.begin()};
+
+	while (first != iov.end())
+	{
+		const auto count{static_cast<int>(std::min<std::size_t>(iov.end() - first, IOV_MAX))};
+		const auto result{retry([&] { return systemCall(&*first, count); })};
+
+		if (result == -1)
+		{
+			throwSystemError(errno, what);
+		}
+
+		if (result == 0 && stopAtEnd)
+		{
+			break;
+		}
+
+		transferred += result;
+
+		for (auto left{static_cast<std::size_t>(result)}; left && first != iov.end(); ++first)
+		{
+			if (left < first->iov_len)
+			{
+				first->iov_base = static_cast<std::byte*>(first->iov_base) + left;
+				first->iov_len -= left;
+				break;
+			}
+
+			left -= first->iov_len;
+		}
+
+		while (first != iov.end() && first->iov_len == 0)
+		{
+			++first;
+		}
+	}
+
+	return transferred;
+}
+} // namespace
+
+BufferSize Buffer::read_from(int fd, BufferSize size)
+{
+	grow(size);
+
+	BufferSize bytesRead{};
+
+	while (bytesRead < size)
+	{
+		const auto result{retry([&] { return ::read(fd, data_ + dataSize_, size - bytesRead); })};
+
+		if (result == -1)
+		{
+			throwSystemError(errno, "read");
+		}
+
+		if (result == 0)
+		{
+			break;
+		}
+
+		bytesRead += result;
+		dataSize_ += result;
+	}
+
+	return bytesRead;
+}
+
+BufferSize Buffer::read_from(int fd, BufferSize size, uint64_t offset)
+{
+	grow(size);
+
+	BufferSize bytesRead{};
+
+	while (bytesRead < size)
+	{
+		const auto result{retry([&] { return ::pread(fd, data_ + dataSize_, size - bytesRead, offset + bytesRead); })};
+
+		if (result == -1)
+		{
+			throwSystemError(errno, "pread");
+		}
+
+		if (result == 0)
+		{
+			break;
+		}
+
+		bytesRead += result;
+		dataSize_ += result;
+	}
+
+	return bytesRead;
+}
+
+void Buffer::write_to(int fd) const
+{
+	for (BufferSize bytesWritten{}; bytesWritten < dataSize_;)
+	{
+		const auto result{retry([&] { return ::write(fd, data_ + bytesWritten, dataSize_ - bytesWritten); })};
+
+		if (result == -1)
+		{
+			throwSystemError(errno, "write");
+		}
+
+		bytesWritten += result;
+	}
+}
+
+void Buffer::write_to(int fd, uint64_t offset) const
+{
+	for (BufferSize bytesWritten{}; bytesWritten < dataSize_;)
+	{
+		const auto result{retry([&] { return ::pwrite(fd, data_ + bytesWritten, dataSize_ - bytesWritten, offset + bytesWritten); })};
+
+		if (result == -1)
+		{
+			throwSystemError(errno, "pwrite");
+		}
+
+		bytesWritten += result;
+	}
+}
+
+std::size_t Buffer::read_from(int fd, std::span<Buffer* const> buffers)
+{
+	std::vector<iovec> iov;
+	iov.reserve(buffers.size());
+
+	for (const auto buffer : buffers)
+	{
+		iov.push_back({buffer->data_ + buffer->dataSize_, buffer->capacity_ - buffer->dataSize_});
+	}
+
+	auto bytesRead{transferAll(iov, true, "readv", [fd](const iovec* first, int count) { return ::readv(fd, first, count); })};
+	const auto result{bytesRead};
+
+	for (const auto buffer : buffers)
+	{
+		const auto filled{static_cast<BufferSize>(std::min<std::size_t>(bytesRead, buffer->capacity_ - buffer->dataSize_))};
+		buffer->dataSize_ += filled;
+		bytesRead -= filled;
+	}
+
+	return result;
+}
+
+void Buffer::write_to(int fd, std::span<const Buffer* const> buffers)
+{
+	std::vector<iovec> iov;
+	iov.reserve(buffers.size());
+
+	for (const auto buffer : buffers)
+	{
+		iov.push_back({buffer->data_, buffer->dataSize_});
+	}
+
+	transferAll(iov, false, "writev", [fd](const iovec* first, int count) { return ::writev(fd, first, count); });
+}
+
+#ifdef BYTE_BUFFER_WITH_IO_URING
+namespace
+{
+constexpr std::size_t ringQueueDepth{256};
+
+// io_uring instance reused by the batches of a thread
+class Ring final
+{
+public:
+	Ring()
+	{
+		if (const auto result{io_uring_queue_init(ringQueueDepth, &ring_, 0)}; result < 0)
+		{
+			throwSystemError(-result, "io_uring_queue_init");
+		}
+	}
+
+	Ring(const Ring&) = delete;
+	Ring& operator=(const Ring&) = delete;
+
+	~Ring()
+	{
+		io_uring_queue_exit(&ring_);
+	}
+
+	[[nodiscard]] io_uring* get() noexcept
+	{
+		return &ring_;
+	}
+
+private:
+	io_uring ring_;
+};
+} // namespace
+
+void Buffer::read_batch(std::span<ReadRequest> requests)
+{
+	thread_local Ring threadRing;
+	const auto ring{threadRing.get()};
+
+	// reads the rest of the request, short reads are resumed like with `pread`
+	const auto queueRead{[ring](ReadRequest& request) {
+		// the read size of an entry is 32-bit, larger requests are completed by the resubmissions
+		const auto size{static_cast<unsigned>(std::min<uint64_t>(request.size - request.bytesRead, std::numeric_limits<unsigned>::max()))};
+		const auto sqe{io_uring_get_sqe(ring)};
+		io_uring_prep_read(sqe, request.fd, request.buffer->data_ + request.buffer->dataSize_, size, request.offset + request.bytesRead);
+		io_uring_sqe_set_data(sqe, &request);
+	}};
+
+	for (auto batch{requests}; !batch.empty();)
+	{
+		const auto count{std::min(batch.size(), ringQueueDepth)};
+
+		// all buffers grow before the first read is queued, so a failing allocation leaves no read in the ring
+		for (auto& request : batch.first(count))
+		{
+			request.buffer->grow(request.size);
+			request.bytesRead = 0;
+		}
+
+		for (auto& request : batch.first(count))
+		{
+			queueRead(request);
+		}
+
+		auto error{0};
+
+		for (auto pending{count}; pending;)
+		{
+			if (const auto result{io_uring_submit_and_wait(ring, 1)}; result < 0 && result != -EINTR)
+			{
+				throwSystemError(-result, "io_uring_submit_and_wait");
+			}
+
+			io_uring_cqe* cqe;
+			unsigned head;
+			unsigned seen{};
+
+			io_uring_for_each_cqe(ring, head, cqe)
+			{
+				++seen;
+				auto& request{*static_cast<ReadRequest*>(io_uring_cqe_get_data(cqe))};
+
+				if (cqe->res < 0)
+				{
+					error = error ? error : -cqe->res;
+					--pending;
+				}
+				else if (cqe->res == 0)
+				{
+					--pending;
+				}
+				else
+				{
+					request.bytesRead += cqe->res;
+					request.buffer->dataSize_ += cqe->res;
+
+					if (request.bytesRead < request.size)
+					{
+						queueRead(request);
+					}
+					else
+					{
+						--pending;
+					}
+				}
+			}
+
+			io_uring_cq_advance(ring, seen);
+		}
+
+		if (error)
+		{
+			throwSystemError(error, "io_uring read");
+		}
+
+		batch = batch.subspan(count);
+	}
+}
+#else
+void Buffer::read_batch(std::span<ReadRequest> requests)
+{
+	for (auto& request : requests)
+	{
+		request.bytesRead = request.buffer->read_from(request.fd, request.size, request.offset);
+	}
+}
+#endif
+} // namespace byte_buffer
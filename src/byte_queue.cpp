@@ -0,0 +1,183 @@
+#include <stdexcept>
+
+#include "../include/byte_buffer/byte_queue.hpp"
+
+namespace byte_buffer
+{
+namespace
+{
+uint64_t checkedRecordSize(std::span<const std::byte> message, BufferSize capacity)
+{
+	const auto size{detail::recordSize(message.size())};
+
+	if (size > capacity)
+	{
+		throw std::length_error("message exceeds the queue capacity");
+	}
+
+	return size;
+}
+
+void writeMessage(std::byte* record, std::span<const std::byte> message) noexcept
+{
+	if (!message.empty())
+	{
+		std::memcpy(record + detail::recordHeaderSize, message.data(), message.size());
+	}
+}
+} // namespace
+
+SpscByteQueue::SpscByteQueue(BufferSize capacity)
+	: memory_{capacity}, writePosition_{}, cachedReadPosition_{}, readPosition_{}, cachedWritePosition_{}
+{
+}
+
+bool SpscByteQueue::try_push(std::span<const std::byte> message)
+{
+	return try_push_batch({&message, 1}) == 1;
+}
+
+std::size_t SpscByteQueue::try_push_batch(std::span<const std::span<const std::byte>> messages)
+{
+	const auto writePosition{writePosition_.load(std::memory_order_relaxed)};
+	auto position{writePosition};
+	std::size_t pushed{};
+
+	for (const auto message : messages)
+	{
+		const auto size{checkedRecordSize(message, memory_.size())};
+
+		if (position + size - cachedReadPosition_ > memory_.size())
+		{
+			cachedReadPosition_ = readPosition_.load(std::memory_order_acquire);
+
+			if (position + size - cachedReadPosition_ > memory_.size())
+			{
+				break;
+			}
+		}
+
+		const auto record{recordAt(position)};
+		const uint64_t messageSize{message.size()};
+		std::memcpy(record, &messageSize, sizeof(messageSize));
+		writeMessage(record, message);
+
+		position += size;
+		++pushed;
+	}
+
+	if (pushed)
+	{
+		writePosition_.store(position, std::memory_order_release);
+	}
+
+	return pushed;
+}
+
+bool SpscByteQueue::try_pop(Buffer& message)
+{
+	return consume([&message](std::span<const std::byte> bytes) { message.overwrite(bytes); }, 1) == 1;
+}
+
+bool SpscByteQueue::empty() const noexcept
+{
+	return readPosition_.load(std::memory_order_acquire) == writePosition_.load(std::memory_order_acquire);
+}
+
+BufferSize SpscByteQueue::capacity() const noexcept
+{
+	return memory_.size();
+}
+
+std::byte* SpscByteQueue::recordAt(uint64_t position) const noexcept
+{
+	return memory_.data() + position % memory_.size();
+}
+
+MpscByteQueue::MpscByteQueue(BufferSize capacity) : memory_{capacity}, claimPosition_{}, readPosition_{} {}
+
+bool MpscByteQueue::try_push(std::span<const std::byte> message)
+{
+	return try_push_batch({&message, 1}) == 1;
+}
+
+std::size_t MpscByteQueue::try_push_batch(std::span<const std::span<const std::byte>> messages)
+{
+	auto claimPosition{claimPosition_.load(std::memory_order_relaxed)};
+	std::size_t count;
+
+	// claims space for the longest prefix of the messages that fits
+	for (;;)
+	{
+		const auto freeSpace{memory_.size() - (claimPosition - readPosition_.load(std::memory_order_acquire))};
+		uint64_t claimSize{};
+		count = 0;
+
+		for (const auto message : messages)
+		{
+			const auto size{checkedRecordSize(message, memory_.size())};
+
+			if (claimSize + size > freeSpace)
+			{
+				break;
+			}
+
+			claimSize += size;
+			++count;
+		}
+
+		if (count == 0)
+		{
+			return 0;
+		}
+
+		if (claimPosition_.compare_exchange_weak(claimPosition, claimPosition + claimSize, std::memory_order_relaxed))
+		{
+			break;
+		}
+	}
+
+	auto position{claimPosition};
+
+	for (const auto message : messages.first(count))
+	{
+		writeMessage(recordAt(position), message);
+		headerAt(position).store(message.size() + 1, std::memory_order_release);
+		position += detail::recordSize(message.size());
+	}
+
+	return count;
+}
+
+bool MpscByteQueue::try_pop(Buffer& message)
+{
+	return consume([&message](std::span<const std::byte> bytes) { message.overwrite(bytes); }, 1) == 1;
+}
+
+bool MpscByteQueue::empty() const noexcept
+{
+	return headerAt(readPosition_.load(std::memory_order_relaxed)).load(std::memory_order_acquire) == 0;
+}
+
+BufferSize MpscByteQueue::capacity() const noexcept
+{
+	return memory_.size();
+}
+
+std::byte* MpscByteQueue::recordAt(uint64_t position) const noexcept
+{
+	return memory_.data() + position % memory_.size();
+}
+
+std::atomic_ref<uint64_t> MpscByteQueue::headerAt(uint64_t position) const noexcept
+{
+	return std::atomic_ref<uint64_t>(*reinterpret_cast<uint64_t*>(recordAt(position)));
+}
+
+void MpscByteQueue::release(uint64_t from, uint64_t to) noexcept
+{
+	// a zero header marks an unpublished record, so the released space is cleared before producers can claim it
+	std::memset(recordAt(from), 0, to - from);
+	readPosition_.store(to, std::memory_order_release);
+}
+} // namespace byte_buffer
@@ -0,0 +1,434 @@
+#include <algorithm>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#ifdef BYTE_BUFFER_WITH_LZ4
+#include <lz4frame.h>
+#endif
+
+#ifdef BYTE_BUFFER_WITH_ZSTD
+// ZSTD_findDecompressedSize is a part of the static linking API
+#define ZSTD_STATIC_LINKING_ONLY
+#include <zstd.h>
+#endif
+
+#include "../include/byte_buffer/compression.hpp"
+
+namespace byte_buffer
+{
+namespace
+{
+#ifdef BYTE_BUFFER_WITH_LZ4
+constexpr bool lz4Enabled{true};
+#else
+constexpr bool lz4Enabled{false};
+#endif
+
+#ifdef BYTE_BUFFER_WITH_ZSTD
+constexpr bool zstdEnabled{true};
+#else
+constexpr bool zstdEnabled{false};
+#endif
+
+// free space requested when the output buffer of a decompression runs out of it
+constexpr BufferSize minWindowSize{64 * 1024};
+
+#if defined(BYTE_BUFFER_WITH_LZ4) || defined(BYTE_BUFFER_WITH_ZSTD)
+// largest pre-sized output per compressed byte, frames claiming more are decompressed by the stream,
+// which grows the output only as far as data is actually produced
+constexpr uint64_t maxPresizeRatio{64};
+
+// content sizes in frame headers come from untrusted data
+bool trustContentSize(uint64_t contentSize, std::size_t compressedSize, const Buffer& output) noexcept
+{
+	return contentSize <= std::max<uint64_t>(minWindowSize, maxPresizeRatio * compressedSize) &&
+		contentSize <= std::numeric_limits<BufferSize>::max() - output.size();
+}
+#endif
+
+using ContextPointer = std::unique_ptr<void, void (*)(void*)>;
+
+void requireCodec(Codec codec)
+{
+	if (!codec_available(codec))
+	{
+		throw std::invalid_argument("codec is not enabled");
+	}
+}
+
+// drops the output appended by a failed decompression
+template <typename Function>
+void restoreOnFailure(Buffer& output, Function&& function)
+{
+	const auto originalSize{output.size()};
+
+	try
+	{
+		function();
+	}
+	catch (...)
+	{
+		output.resize_uninitialized(originalSize);
+		throw;
+	}
+}
+
+#ifdef BYTE_BUFFER_WITH_LZ4
+std::size_t checkLz4(std::size_t result)
+{
+	if (LZ4F_isError(result))
+	{
+		throw std::runtime_error(std::string("lz4: ") + LZ4F_getErrorName(result));
+	}
+
+	return result;
+}
+
+LZ4F_preferences_t lz4Preferences(int level, unsigned long long contentSize) noexcept
+{
+	LZ4F_preferences_t preferences{};
+	preferences.compressionLevel = level;
+	preferences.frameInfo.contentSize = contentSize;
+
+	return preferences;
+}
+
+// content size stored in the header of the first frame, 0 if absent
+uint64_t lz4ContentSize(std::span<const std::byte> bytes) noexcept
+{
+	constexpr std::size_t headerSize{14};
+	constexpr uint32_t magic{0x184D2204};
+	constexpr auto contentSizeFlag{std::byte{0x08}};
+
+	if (bytes.size() < headerSize)
+	{
+		return 0;
+	}
+
+	uint32_t frameMagic{};
+	uint64_t contentSize{};
+
+	for (std::size_t i{}; i < sizeof(frameMagic); ++i)
+	{
+		frameMagic |= std::to_integer<uint32_t>(bytes[i]) << (8 * i);
+	}
+
+	if (frameMagic != magic || (bytes[4] & contentSizeFlag) == std::byte{})
+	{
+		return 0;
+	}
+
+	for (std::size_t i{}; i < sizeof(contentSize); ++i)
+	{
+		contentSize |= std::to_integer<uint64_t>(bytes[6 + i]) << (8 * i);
+	}
+
+	return contentSize;
+}
+#endif
+
+#ifdef BYTE_BUFFER_WITH_ZSTD
+std::size_t checkZstd(std::size_t result)
+{
+	if (ZSTD_isError(result))
+	{
+		throw std::runtime_error(std::string("zstd: ") + ZSTD_getErrorName(result));
+	}
+
+	return result;
+}
+#endif
+
+void noDelete(void*) noexcept {}
+} // namespace
+
+bool codec_available(Codec codec) noexcept
+{
+	return codec == Codec::lz4 ? lz4Enabled : zstdEnabled;
+}
+
+void compress(Codec codec, [[maybe_unused]] std::span<const std::byte> bytes, [[maybe_unused]] Buffer& output, [[maybe_unused]] int level)
+{
+	requireCodec(codec);
+
+#ifdef BYTE_BUFFER_WITH_LZ4
+	if (codec == Codec::lz4)
+	{
+		const auto preferences{lz4Preferences(level, bytes.size())};
+		const auto window{output.prepare(LZ4F_compressFrameBound(bytes.size(), &preferences))};
+		output.commit(checkLz4(LZ4F_compressFrame(window.data(), window.size(), bytes.data(), bytes.size(), &preferences)));
+	}
+#endif
+
+#ifdef BYTE_BUFFER_WITH_ZSTD
+	if (codec == Codec::zstd)
+	{
+		const auto window{output.prepare(ZSTD_compressBound(bytes.size()))};
+		output.commit(checkZstd(ZSTD_compress(window.data(), window.size(), bytes.data(), bytes.size(), level)));
+	}
+#endif
+}
+
+void decompress(Codec codec, std::span<const std::byte> bytes, Buffer& output)
+{
+	requireCodec(codec);
+	restoreOnFailure(output, [&] {
+#ifdef BYTE_BUFFER_WITH_LZ4
+		if (codec == Codec::lz4)
+		{
+			if (const auto size{lz4ContentSize(bytes)}; size && trustContentSize(size, bytes.size(), output))
+			{
+				output.reserve(static_cast<BufferSize>(output.size() + size));
+			}
+		}
+#endif
+
+#ifdef BYTE_BUFFER_WITH_ZSTD
+		if (codec == Codec::zstd)
+		{
+			const auto size{ZSTD_findDecompressedSize(bytes.data(), bytes.size())};
+
+			if (size == ZSTD_CONTENTSIZE_ERROR)
+			{
+				throw std::runtime_error("zstd: invalid frame");
+			}
+
+			if (size != ZSTD_CONTENTSIZE_UNKNOWN && trustContentSize(size, bytes.size(), output))
+			{
+				decompress(codec, bytes, output, static_cast<BufferSize>(size));
+				return;
+			}
+		}
+#endif
+
+		DecompressionStream stream(codec, output);
+		stream.write(bytes);
+
+		if (!stream.finished())
+		{
+			throw std::runtime_error("compressed data is truncated");
+		}
+	});
+}
+
+void decompress(Codec codec, std::span<const std::byte> bytes, Buffer& output, BufferSize size)
+{
+	requireCodec(codec);
+
+	if (size > std::numeric_limits<BufferSize>::max() - output.size())
+	{
+		throw std::length_error("byte buffer size exceeds the maximum size");
+	}
+
+	restoreOnFailure(output, [&] {
+#ifdef BYTE_BUFFER_WITH_ZSTD
+		if (codec == Codec::zstd)
+		{
+			const auto window{output.prepare(size)};
+			output.commit(checkZstd(ZSTD_decompress(window.data(), window.size(), bytes.data(), bytes.size())));
+			return;
+		}
+#endif
+
+		const auto expectedSize{output.size() + size};
+		output.reserve(expectedSize);
+
+		DecompressionStream stream(codec, output);
+		stream.write(bytes);
+
+		if (!stream.finished())
+		{
+			throw std::runtime_error("compressed data is truncated");
+		}
+
+		if (output.size() > expectedSize)
+		{
+			throw std::runtime_error("decompressed data exceeds the expected size");
+		}
+	});
+}
+
+CompressionStream::CompressionStream(Codec codec, Buffer& output, int level)
+	: codec_{codec}, output_{output}, level_{level}, begun_{}, context_{nullptr, noDelete}
+{
+	requireCodec(codec);
+
+#ifdef BYTE_BUFFER_WITH_LZ4
+	if (codec == Codec::lz4)
+	{
+		LZ4F_cctx* context{};
+		checkLz4(LZ4F_createCompressionContext(&context, LZ4F_VERSION));
+		context_ = ContextPointer(context, [](void* context) { LZ4F_freeCompressionContext(static_cast<LZ4F_cctx*>(context)); });
+	}
+#endif
+
+#ifdef BYTE_BUFFER_WITH_ZSTD
+	if (codec == Codec::zstd)
+	{
+		const auto context{ZSTD_createCCtx()};
+
+		if (!context)
+		{
+			throw std::bad_alloc();
+		}
+
+		context_ = ContextPointer(context, [](void* context) { ZSTD_freeCCtx(static_cast<ZSTD_CCtx*>(context)); });
+		checkZstd(ZSTD_CCtx_setParameter(context, ZSTD_c_compressionLevel, level));
+	}
+#endif
+}
+
+void CompressionStream::write([[maybe_unused]] std::span<const std::byte> bytes)
+{
+#ifdef BYTE_BUFFER_WITH_LZ4
+	if (codec_ == Codec::lz4)
+	{
+		if (!begun_)
+		{
+			begin();
+		}
+
+		const auto preferences{lz4Preferences(level_, 0)};
+		const auto window{output_.prepare(LZ4F_compressBound(bytes.size(), &preferences))};
+		output_.commit(checkLz4(LZ4F_compressUpdate(static_cast<LZ4F_cctx*>(context_.get()), window.data(), window.size(),
+			bytes.data(), bytes.size(), nullptr)));
+	}
+#endif
+
+#ifdef BYTE_BUFFER_WITH_ZSTD
+	if (codec_ == Codec::zstd)
+	{
+		ZSTD_inBuffer input{bytes.data(), bytes.size(), 0};
+
+		while (input.pos < input.size)
+		{
+			const auto window{output_.prepare(ZSTD_compressBound(input.size - input.pos))};
+			ZSTD_outBuffer output{window.data(), window.size(), 0};
+			checkZstd(ZSTD_compressStream2(static_cast<ZSTD_CCtx*>(context_.get()), &output, &input, ZSTD_e_continue));
+			output_.commit(output.pos);
+		}
+	}
+#endif
+}
+
+void CompressionStream::finish()
+{
+#ifdef BYTE_BUFFER_WITH_LZ4
+	if (codec_ == Codec::lz4)
+	{
+		if (!begun_)
+		{
+			begin();
+		}
+
+		const auto preferences{lz4Preferences(level_, 0)};
+		const auto window{output_.prepare(LZ4F_compressBound(0, &preferences))};
+		output_.commit(checkLz4(LZ4F_compressEnd(static_cast<LZ4F_cctx*>(context_.get()), window.data(), window.size(), nullptr)));
+		begun_ = false;
+	}
+#endif
+
+#ifdef BYTE_BUFFER_WITH_ZSTD
+	if (codec_ == Codec::zstd)
+	{
+		ZSTD_inBuffer input{nullptr, 0, 0};
+
+		for (std::size_t remaining{1}; remaining;)
+		{
+			const auto window{output_.prepare(ZSTD_CStreamOutSize())};
+			ZSTD_outBuffer output{window.data(), window.size(), 0};
+			remaining = checkZstd(ZSTD_compressStream2(static_cast<ZSTD_CCtx*>(context_.get()), &output, &input, ZSTD_e_end));
+			output_.commit(output.pos);
+		}
+	}
+#endif
+}
+
+void CompressionStream::begin()
+{
+#ifdef BYTE_BUFFER_WITH_LZ4
+	const auto preferences{lz4Preferences(level_, 0)};
+	const auto window{output_.prepare(LZ4F_HEADER_SIZE_MAX)};
+	output_.commit(checkLz4(LZ4F_compressBegin(static_cast<LZ4F_cctx*>(context_.get()), window.data(), window.size(), &preferences)));
+	begun_ = true;
+#endif
+}
+
+DecompressionStream::DecompressionStream(Codec codec, Buffer& output) : codec_{codec}, output_{output}, finished_{true}, context_{nullptr, noDelete}
+{
+	requireCodec(codec);
+
+#ifdef BYTE_BUFFER_WITH_LZ4
+	if (codec == Codec::lz4)
+	{
+		LZ4F_dctx* context{};
+		checkLz4(LZ4F_createDecompressionContext(&context, LZ4F_VERSION));
+		context_ = ContextPointer(context, [](void* context) { LZ4F_freeDecompressionContext(static_cast<LZ4F_dctx*>(context)); });
+	}
+#endif
+
+#ifdef BYTE_BUFFER_WITH_ZSTD
+	if (codec == Codec::zstd)
+	{
+		const auto context{ZSTD_createDCtx()};
+
+		if (!context)
+		{
+			throw std::bad_alloc();
+		}
+
+		context_ = ContextPointer(context, [](void* context) { ZSTD_freeDCtx(static_cast<ZSTD_DCtx*>(context)); });
+	}
+#endif
+}
+
+void DecompressionStream::write(std::span<const std::byte> bytes)
+{
+	// a filled window may leave decompressed data inside the codec even when all input is consumed
+	for (auto filled{false}; !bytes.empty() || (filled && !finished_);)
+	{
+		const auto window{this->window()};
+		std::size_t written{};
+		std::size_t read{};
+
+#ifdef BYTE_BUFFER_WITH_LZ4
+		if (codec_ == Codec::lz4)
+		{
+			written = window.size();
+			read = bytes.size();
+			finished_ = checkLz4(LZ4F_decompress(static_cast<LZ4F_dctx*>(context_.get()), window.data(), &written, bytes.data(), &read, nullptr)) == 0;
+		}
+#endif
+
+#ifdef BYTE_BUFFER_WITH_ZSTD
+		if (codec_ == Codec::zstd)
+		{
+			ZSTD_inBuffer input{bytes.data(), bytes.size(), 0};
+			ZSTD_outBuffer output{window.data(), window.size(), 0};
+			finished_ = checkZstd(ZSTD_decompressStream(static_cast<ZSTD_DCtx*>(context_.get()), &output, &input)) == 0;
+			written = output.pos;
+			read = input.pos;
+		}
+#endif
+
+		output_.commit(written);
+		bytes = bytes.subspan(read);
+		filled = written == window.size();
+	}
+}
+
+bool DecompressionStream::finished() const noexcept
+{
+	return finished_;
+}
+
+std::span<std::byte> DecompressionStream::window()
+{
+	const auto freeSpace{output_.capacity() - output_.size()};
+
+	// the buffer at least doubles once it is full, so its data is not reallocated for every chunk
+	return output_.prepare(freeSpace ? freeSpace : std::max(output_.size(), minWindowSize));
+}
+} // namespace byte_buffer
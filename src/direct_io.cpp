@@ -0,0 +1,313 @@
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+#include "../include/byte_buffer/direct_io.hpp"
+
+namespace byte_buffer
+{
+namespace
+{
+[[noreturn]] void throwSystemError(int error, const char* what)
+{
+	throw std::system_error(error, std::generic_category(), what);
+}
+
+BufferSize alignedChunkSize(BufferSize chunkSize) noexcept
+{
+	return std::max<BufferSize>((chunkSize + DirectReader::blockSize - 1) / DirectReader::blockSize * DirectReader::blockSize,
+		DirectReader::blockSize);
+}
+
+// opens with O_DIRECT, falling back to buffered I/O on file systems that reject it
+int openDirect(const std::filesystem::path& path, int flags, bool& direct)
+{
+	auto fd{::open(path.c_str(), flags | O_CLOEXEC | O_DIRECT, 0644)};
+	direct = fd != -1;
+
+	if (fd == -1 && errno == EINVAL)
+	{
+		fd = ::open(path.c_str(), flags | O_CLOEXEC, 0644);
+	}
+
+	if (fd == -1)
+	{
+		throwSystemError(errno, "open");
+	}
+
+	return fd;
+}
+
+// closes a file descriptor unless released once its owner is fully constructed
+class DescriptorGuard final
+{
+public:
+	explicit DescriptorGuard(int fd) noexcept : fd_{fd} {}
+	DescriptorGuard(const DescriptorGuard&) = delete;
+	DescriptorGuard& operator=(const DescriptorGuard&) = delete;
+
+	~DescriptorGuard()
+	{
+		if (fd_ != -1)
+		{
+			::close(fd_);
+		}
+	}
+
+	void release() noexcept
+	{
+		fd_ = -1;
+	}
+
+private:
+	int fd_;
+};
+
+Buffer alignedChunk(BufferSize chunkSize)
+{
+	Buffer chunk;
+	chunk.set_alignment(DirectReader::blockSize);
+	chunk.reserve(chunkSize);
+
+	return chunk;
+}
+} // namespace
+
+DirectReader::DirectReader(const std::filesystem::path& path, uint64_t offset, BufferSize chunkSize)
+	: fd_{-1}, direct_{}, fileSize_{}, nextOffset_{offset / blockSize * blockSize}, skip_{static_cast<BufferSize>(offset % blockSize)},
+	  chunkSize_{alignedChunkSize(chunkSize)}, chunks_{alignedChunk(chunkSize_), alignedChunk(chunkSize_)}, current_{}
+{
+	fd_ = openDirect(path, O_RDONLY, direct_);
+	DescriptorGuard guard(fd_);
+
+	struct stat fileStat{};
+
+	if (::fstat(fd_, &fileStat) == -1)
+	{
+		throwSystemError(errno, "fstat");
+	}
+
+	fileSize_ = static_cast<uint64_t>(fileStat.st_size);
+
+	// starting the first read may fail to create its thread
+	prefetch();
+	guard.release();
+}
+
+DirectReader::~DirectReader()
+{
+	if (pending_.valid())
+	{
+		pending_.wait();
+	}
+
+	::close(fd_);
+}
+
+std::span<const std::byte> DirectReader::next()
+{
+	if (!pending_.valid())
+	{
+		return {};
+	}
+
+	pending_.get();
+	current_ ^= 1;
+
+	const auto& chunk{chunks_[current_]};
+
+	// a short chunk ends the file
+	if (chunk.size() == chunkSize_)
+	{
+		prefetch();
+	}
+
+	const auto data{chunk.data().subspan(std::min(skip_, chunk.size()))};
+	skip_ = 0;
+
+	return data;
+}
+
+void DirectReader::append_to(Buffer& buffer)
+{
+	const auto position{nextOffset_ - (pending_.valid() ? chunkSize_ : 0) + skip_};
+
+	if (fileSize_ > position)
+	{
+		buffer.reserve(buffer.size() + static_cast<BufferSize>(fileSize_ - position));
+	}
+
+	for (auto chunk{next()}; !chunk.empty(); chunk = next())
+	{
+		buffer.append(chunk);
+	}
+}
+
+bool DirectReader::direct() const noexcept
+{
+	return direct_;
+}
+
+void DirectReader::prefetch()
+{
+	pending_ = std::async(std::launch::async, [this, &chunk = chunks_[current_ ^ 1], offset = nextOffset_] { read(chunk, offset); });
+	nextOffset_ += chunkSize_;
+}
+
+void DirectReader::read(Buffer& chunk, uint64_t offset) const
+{
+	chunk.clear();
+	const auto window{chunk.prepare(chunkSize_)};
+
+	BufferSize bytesRead{};
+
+	while (bytesRead < chunkSize_)
+	{
+		const auto result{::pread(fd_, window.data() + bytesRead, chunkSize_ - bytesRead, static_cast<off_t>(offset + bytesRead))};
+
+		if (result == -1 && errno == EINTR)
+		{
+			continue;
+		}
+
+		if (result == -1)
+		{
+			throwSystemError(errno, "pread");
+		}
+
+		bytesRead += result;
+
+		// an unaligned short read reaches the end of the file, a further direct read would be rejected
+		if (result == 0 || result % blockSize)
+		{
+			break;
+		}
+	}
+
+	chunk.commit(bytesRead);
+
+	if (!direct_ && bytesRead)
+	{
+		::posix_fadvise(fd_, static_cast<off_t>(offset), bytesRead, POSIX_FADV_DONTNEED);
+	}
+}
+
+DirectWriter::DirectWriter(const std::filesystem::path& path, BufferSize chunkSize)
+	: fd_{-1}, direct_{}, offset_{}, chunkSize_{alignedChunkSize(chunkSize)}, chunks_{alignedChunk(chunkSize_), alignedChunk(chunkSize_)}, current_{}
+{
+	// the chunks are allocated by the initializers, so nothing can throw after the file is opened
+	fd_ = openDirect(path, O_WRONLY | O_CREAT | O_TRUNC, direct_);
+}
+
+DirectWriter::~DirectWriter()
+{
+	try
+	{
+		close();
+	}
+	catch (...)
+	{
+		// errors are reported only by an explicit close
+	}
+}
+
+void DirectWriter::write(std::span<const std::byte> bytes)
+{
+	while (!bytes.empty())
+	{
+		auto& chunk{chunks_[current_]};
+		const auto size{std::min<std::size_t>(bytes.size(), chunkSize_ - chunk.size())};
+
+		chunk.append(bytes.first(size));
+		bytes = bytes.subspan(size);
+
+		if (chunk.size() == chunkSize_)
+		{
+			submit();
+		}
+	}
+}
+
+void DirectWriter::close()
+{
+	if (fd_ == -1)
+	{
+		return;
+	}
+
+	try
+	{
+		waitPending();
+
+		if (auto& chunk{chunks_[current_]}; !chunk.empty())
+		{
+			// the padding of the last block is cut off by truncating the file to its real size
+			const auto size{chunk.size()};
+			const auto padding{chunk.prepare((direct_ ? alignedChunkSize(size) : size) - size)};
+			std::memset(padding.data(), 0, padding.size());
+			chunk.commit(padding.size());
+
+			submit();
+			waitPending();
+
+			if (!padding.empty() && ::ftruncate(fd_, static_cast<off_t>(offset_ - padding.size())) == -1)
+			{
+				throwSystemError(errno, "ftruncate");
+			}
+		}
+	}
+	catch (...)
+	{
+		::close(std::exchange(fd_, -1));
+		throw;
+	}
+
+	if (::close(std::exchange(fd_, -1)) == -1)
+	{
+		throwSystemError(errno, "close");
+	}
+}
+
+bool DirectWriter::direct() const noexcept
+{
+	return direct_;
+}
+
+void DirectWriter::submit()
+{
+	waitPending();
+
+	pending_ = std::async(std::launch::async, [fd = fd_, &chunk = chunks_[current_], offset = offset_] {
+		const auto data{chunk.data()};
+
+		for (std::size_t bytesWritten{}; bytesWritten < data.size();)
+		{
+			const auto result{::pwrite(fd, data.data() + bytesWritten, data.size() - bytesWritten, static_cast<off_t>(offset + bytesWritten))};
+
+			if (result == -1 && errno != EINTR)
+			{
+				throwSystemError(errno, "pwrite");
+			}
+
+			bytesWritten += std::max<ssize_t>(result, 0);
+		}
+	});
+
+	offset_ += chunks_[current_].size();
+	current_ ^= 1;
+	chunks_[current_].clear();
+}
+
+void DirectWriter::waitPending()
+{
+	if (pending_.valid())
+	{
+		pending_.get();
+	}
+}
+} // namespace byte_buffer
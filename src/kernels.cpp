@@ -0,0 +1,521 @@
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+
+// the SSE2 kernels are compiled without a target attribute, so they rely on the x86-64 baseline
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BYTE_BUFFER_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+#include "../include/byte_buffer/kernels.hpp"
+
+namespace byte_buffer::kernels
+{
+namespace
+{
+using FindByte = std::size_t (*)(std::span<const std::byte>, std::byte) noexcept;
+using FindPattern = std::size_t (*)(std::span<const std::byte>, std::span<const std::byte>) noexcept;
+using Equal = bool (*)(std::span<const std::byte>, std::span<const std::byte>) noexcept;
+using Crc32c = uint32_t (*)(std::span<const std::byte>, uint32_t) noexcept;
+
+struct Dispatch
+{
+	FindByte findByte;
+	FindPattern findPattern;
+	Equal equal;
+	Crc32c crc32c;
+	const char* isa;
+};
+
+constexpr auto crc32cTable{[] {
+	std::array<uint32_t, 256> table{};
+
+	for (uint32_t i{}; i < table.size(); ++i)
+	{
+		auto crc{i};
+
+		for (auto bit{0}; bit < 8; ++bit)
+		{
+			crc = (crc >> 1) ^ (0x82f63b78u & (0u - (crc & 1)));
+		}
+
+		table[i] = crc;
+	}
+
+	return table;
+}()};
+
+uint64_t load64(const std::byte* p) noexcept
+{
+	uint64_t value;
+	std::memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+uint32_t load32(const std::byte* p) noexcept
+{
+	uint32_t value;
+	std::memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+#ifdef BYTE_BUFFER_X86_KERNELS
+// SSE2 is part of the x86-64 baseline, the 16-byte kernels need only the CRC instructions of SSE4.2
+std::size_t findByteSse(std::span<const std::byte> data, std::byte value) noexcept
+{
+	const auto needle{_mm_set1_epi8(static_cast<char>(value))};
+	std::size_t i{};
+
+	for (; i + 16 <= data.size(); i += 16)
+	{
+		const auto chunk{_mm_loadu_si128(reinterpret_cast<const __m128i*>(data.data() + i))};
+
+		if (const auto mask{_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, needle))})
+		{
+			return i + __builtin_ctz(static_cast<unsigned>(mask));
+		}
+	}
+
+	const auto tail{scalar::find(data.subspan(i), value)};
+
+	return tail == npos ? npos : i + tail;
+}
+
+__attribute__((target("avx2"))) std::size_t findByteAvx2(std::span<const std::byte> data, std::byte value) noexcept
+{
+	const auto needle{_mm256_set1_epi8(static_cast<char>(value))};
+	std::size_t i{};
+
+	for (; i + 32 <= data.size(); i += 32)
+	{
+		const auto chunk{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.data() + i))};
+
+		if (const auto mask{_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, needle))})
+		{
+			return i + __builtin_ctz(static_cast<unsigned>(mask));
+		}
+	}
+
+	const auto tail{findByteSse(data.subspan(i), value)};
+
+	return tail == npos ? npos : i + tail;
+}
+
+// candidates are the positions where both the first and the last pattern byte match
+__attribute__((target("avx2"))) std::size_t findPatternAvx2(std::span<const std::byte> data, std::span<const std::byte> pattern) noexcept
+{
+	if (pattern.size() < 2 || pattern.size() > data.size())
+	{
+		return scalar::find(data, pattern);
+	}
+
+	const auto first{_mm256_set1_epi8(static_cast<char>(pattern.front()))};
+	const auto last{_mm256_set1_epi8(static_cast<char>(pattern.back()))};
+	const auto lastOffset{pattern.size() - 1};
+	const auto end{data.size() - pattern.size() + 1};
+	std::size_t i{};
+
+	for (; i + 32 <= end; i += 32)
+	{
+		const auto blockFirst{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.data() + i))};
+		const auto blockLast{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data.data() + i + lastOffset))};
+		auto mask{static_cast<unsigned>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last))))};
+
+		while (mask)
+		{
+			const auto candidate{i + __builtin_ctz(mask)};
+
+			if (std::memcmp(data.data() + candidate + 1, pattern.data() + 1, pattern.size() - 2) == 0)
+			{
+				return candidate;
+			}
+
+			mask &= mask - 1;
+		}
+	}
+
+	const auto tail{scalar::find(data.subspan(i), pattern)};
+
+	return tail == npos ? npos : i + tail;
+}
+
+bool equalSse(std::span<const std::byte> lhs, std::span<const std::byte> rhs) noexcept
+{
+	if (lhs.size() != rhs.size())
+	{
+		return false;
+	}
+
+	std::size_t i{};
+
+	for (; i + 16 <= lhs.size(); i += 16)
+	{
+		const auto l{_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs.data() + i))};
+		const auto r{_mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs.data() + i))};
+
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(l, r)) != 0xffff)
+		{
+			return false;
+		}
+	}
+
+	return scalar::equal(lhs.subspan(i), rhs.subspan(i));
+}
+
+__attribute__((target("avx2"))) bool equalAvx2(std::span<const std::byte> lhs, std::span<const std::byte> rhs) noexcept
+{
+	if (lhs.size() != rhs.size())
+	{
+		return false;
+	}
+
+	std::size_t i{};
+
+	for (; i + 32 <= lhs.size(); i += 32)
+	{
+		const auto l{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs.data() + i))};
+		const auto r{_mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs.data() + i))};
+
+		if (static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(l, r))) != 0xffffffffu)
+		{
+			return false;
+		}
+	}
+
+	return equalSse(lhs.subspan(i), rhs.subspan(i));
+}
+
+__attribute__((target("sse4.2"))) uint32_t crc32cSse42(std::span<const std::byte> data, uint32_t crc) noexcept
+{
+	auto p{data.data()};
+	auto left{data.size()};
+	uint64_t state{~crc};
+
+	for (; left >= 8; p += 8, left -= 8)
+	{
+		state = _mm_crc32_u64(state, load64(p));
+	}
+
+	auto state32{static_cast<uint32_t>(state)};
+
+	for (; left; ++p, --left)
+	{
+		state32 = _mm_crc32_u8(state32, std::to_integer<uint8_t>(*p));
+	}
+
+	return ~state32;
+}
+#endif
+
+Dispatch selectKernels() noexcept
+{
+#ifdef BYTE_BUFFER_X86_KERNELS
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("sse4.2"))
+	{
+		return {findByteAvx2, findPatternAvx2, equalAvx2, crc32cSse42, "avx2"};
+	}
+
+	if (__builtin_cpu_supports("sse4.2"))
+	{
+		return {findByteSse, scalar::find, equalSse, crc32cSse42, "sse4.2"};
+	}
+#endif
+
+	return {scalar::find, scalar::find, scalar::equal, scalar::crc32c, "scalar"};
+}
+
+const Dispatch& dispatch() noexcept
+{
+	static const auto kernels{selectKernels()};
+	return kernels;
+}
+
+constexpr uint32_t crc32cPolynomial{0x82f63b78u};
+
+// multiplies two polynomials modulo the CRC polynomial, in the reflected bit order of the checksum
+constexpr uint32_t multiplyModulo(uint32_t lhs, uint32_t rhs) noexcept
+{
+	uint32_t product{};
+
+	for (uint32_t bit{1u << 31}; bit; bit >>= 1)
+	{
+		if (lhs & bit)
+		{
+			product ^= rhs;
+		}
+
+		rhs = (rhs >> 1) ^ (crc32cPolynomial & (0u - (rhs & 1)));
+	}
+
+	return product;
+}
+
+// x^(2^n) modulo the CRC polynomial
+constexpr auto powerTable{[] {
+	// bit k of a byte count selects x^(2^(k + 3)), so a 64-bit count needs 67 entries
+	std::array<uint32_t, std::numeric_limits<std::size_t>::digits + 3> table{};
+	table[0] = 1u << 30;
+
+	for (std::size_t i{1}; i < table.size(); ++i)
+	{
+		table[i] = multiplyModulo(table[i - 1], table[i - 1]);
+	}
+
+	return table;
+}()};
+
+constexpr uint64_t prime1{0x9e3779b185ebca87ull};
+constexpr uint64_t prime2{0xc2b2ae3d27d4eb4full};
+constexpr uint64_t prime3{0x165667b19e3779f9ull};
+constexpr uint64_t prime4{0x85ebca77c2b2ae63ull};
+constexpr uint64_t prime5{0x27d4eb2f165667c5ull};
+
+constexpr uint64_t rotl(uint64_t value, int count) noexcept
+{
+	return (value << count) | (value >> (64 - count));
+}
+
+constexpr uint64_t hashRound(uint64_t accumulator, uint64_t input) noexcept
+{
+	return rotl(accumulator + input * prime2, 31) * prime1;
+}
+
+constexpr uint64_t hashMergeRound(uint64_t accumulator, uint64_t value) noexcept
+{
+	return (accumulator ^ hashRound(0, value)) * prime1 + prime4;
+}
+} // namespace
+
+std::size_t find(std::span<const std::byte> data, std::byte value) noexcept
+{
+	return dispatch().findByte(data, value);
+}
+
+std::size_t find(std::span<const std::byte> data, std::span<const std::byte> pattern) noexcept
+{
+	return dispatch().findPattern(data, pattern);
+}
+
+bool equal(std::span<const std::byte> lhs, std::span<const std::byte> rhs) noexcept
+{
+	return dispatch().equal(lhs, rhs);
+}
+
+uint32_t crc32c(std::span<const std::byte> data, uint32_t crc) noexcept
+{
+	return dispatch().crc32c(data, crc);
+}
+
+// the XXH64 algorithm is a scalar multiply-rotate chain with no profitable SIMD form, so it is not dispatched
+uint64_t hash64(std::span<const std::byte> data, uint64_t seed) noexcept
+{
+	auto p{data.data()};
+	const auto end{p + data.size()};
+	uint64_t hash;
+
+	if (data.size() >= 32)
+	{
+		auto v1{seed + prime1 + prime2};
+		auto v2{seed + prime2};
+		auto v3{seed};
+		auto v4{seed - prime1};
+
+		for (; p + 32 <= end; p += 32)
+		{
+			v1 = hashRound(v1, load64(p));
+			v2 = hashRound(v2, load64(p + 8));
+			v3 = hashRound(v3, load64(p + 16));
+			v4 = hashRound(v4, load64(p + 24));
+		}
+
+		hash = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+		hash = hashMergeRound(hash, v1);
+		hash = hashMergeRound(hash, v2);
+		hash = hashMergeRound(hash, v3);
+		hash = hashMergeRound(hash, v4);
+	}
+	else
+	{
+		hash = seed + prime5;
+	}
+
+	hash += data.size();
+
+	for (; p + 8 <= end; p += 8)
+	{
+		hash ^= hashRound(0, load64(p));
+		hash = rotl(hash, 27) * prime1 + prime4;
+	}
+
+	if (p + 4 <= end)
+	{
+		hash ^= load32(p) * prime1;
+		hash = rotl(hash, 23) * prime2 + prime3;
+		p += 4;
+	}
+
+	for (; p < end; ++p)
+	{
+		hash ^= std::to_integer<uint8_t>(*p) * prime5;
+		hash = rotl(hash, 11) * prime1;
+	}
+
+	hash ^= hash >> 33;
+	hash *= prime2;
+	hash ^= hash >> 29;
+	hash *= prime3;
+	hash ^= hash >> 32;
+
+	return hash;
+}
+
+void copy_non_temporal(std::span<std::byte> destination, std::span<const std::byte> source) noexcept
+{
+	if (source.empty())
+	{
+		return;
+	}
+
+#ifdef BYTE_BUFFER_X86_KERNELS
+	auto target{destination.data()};
+	auto p{source.data()};
+	auto left{source.size()};
+
+	// streaming stores need an aligned destination, the unaligned head and the tail are copied through the cache
+	const auto head{std::min<std::size_t>(left, -reinterpret_cast<uintptr_t>(target) & 15)};
+	std::memcpy(target, p, head);
+	target += head;
+	p += head;
+	left -= head;
+
+	for (; left >= 64; target += 64, p += 64, left -= 64)
+	{
+		const auto chunk0{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))};
+		const auto chunk1{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 16))};
+		const auto chunk2{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 32))};
+		const auto chunk3{_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 48))};
+		_mm_stream_si128(reinterpret_cast<__m128i*>(target), chunk0);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(target + 16), chunk1);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(target + 32), chunk2);
+		_mm_stream_si128(reinterpret_cast<__m128i*>(target + 48), chunk3);
+	}
+
+	for (; left >= 16; target += 16, p += 16, left -= 16)
+	{
+		_mm_stream_si128(reinterpret_cast<__m128i*>(target), _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+	}
+
+	std::memcpy(target, p, left);
+
+	// orders the weakly ordered streaming stores before later stores of the thread
+	_mm_sfence();
+#else
+	std::memcpy(destination.data(), source.data(), source.size());
+#endif
+}
+
+void fill_non_temporal(std::span<std::byte> destination, std::byte value) noexcept
+{
+	if (destination.empty())
+	{
+		return;
+	}
+
+#ifdef BYTE_BUFFER_X86_KERNELS
+	auto target{destination.data()};
+	auto left{destination.size()};
+	const auto pattern{_mm_set1_epi8(static_cast<char>(value))};
+
+	const auto head{std::min<std::size_t>(left, -reinterpret_cast<uintptr_t>(target) & 15)};
+	std::memset(target, std::to_integer<int>(value), head);
+	target += head;
+	left -= head;
+
+	for (; left >= 16; target += 16, left -= 16)
+	{
+		_mm_stream_si128(reinterpret_cast<__m128i*>(target), pattern);
+	}
+
+	std::memset(target, std::to_integer<int>(value), left);
+	_mm_sfence();
+#else
+	std::memset(destination.data(), std::to_integer<int>(value), destination.size());
+#endif
+}
+
+// appending n zero bytes multiplies the checksum by x^(8n), done by squaring through the bits of n
+uint32_t crc32c_combine(uint32_t crc, uint32_t nextCrc, std::size_t nextSize) noexcept
+{
+	auto power{1u << 31};
+
+	for (std::size_t i{3}; nextSize; nextSize >>= 1, ++i)
+	{
+		if (nextSize & 1)
+		{
+			power = multiplyModulo(powerTable[i], power);
+		}
+	}
+
+	return multiplyModulo(power, crc) ^ nextCrc;
+}
+
+const char* isa() noexcept
+{
+	return dispatch().isa;
+}
+
+namespace scalar
+{
+std::size_t find(std::span<const std::byte> data, std::byte value) noexcept
+{
+	for (std::size_t i{}; i < data.size(); ++i)
+	{
+		if (data[i] == value)
+		{
+			return i;
+		}
+	}
+
+	return npos;
+}
+
+std::size_t find(std::span<const std::byte> data, std::span<const std::byte> pattern) noexcept
+{
+	if (pattern.size() > data.size())
+	{
+		return npos;
+	}
+
+	for (std::size_t i{}; i + pattern.size() <= data.size(); ++i)
+	{
+		if (pattern.empty() || std::memcmp(data.data() + i, pattern.data(), pattern.size()) == 0)
+		{
+			return i;
+		}
+	}
+
+	return npos;
+}
+
+bool equal(std::span<const std::byte> lhs, std::span<const std::byte> rhs) noexcept
+{
+	return lhs.size() == rhs.size() && (lhs.empty() || std::memcmp(lhs.data(), rhs.data(), lhs.size()) == 0);
+}
+
+uint32_t crc32c(std::span<const std::byte> data, uint32_t crc) noexcept
+{
+	crc = ~crc;
+
+	for (const auto byte : data)
+	{
+		crc = (crc >> 8) ^ crc32cTable[(crc ^ std::to_integer<uint8_t>(byte)) & 0xff];
+	}
+
+	return ~crc;
+}
+} // namespace scalar
+} // namespace byte_buffer::kernels
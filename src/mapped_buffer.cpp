@@ -0,0 +1,154 @@
+#include <cerrno>
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+#include "../include/byte_buffer/mapped_buffer.hpp"
+
+namespace byte_buffer
+{
+MappedBuffer::MappedBuffer() noexcept : mapping_{}, mappingSize_{}, data_{}, dataSize_{} {}
+
+MappedBuffer::MappedBuffer(const std::filesystem::path& path, std::size_t offset, std::size_t length) : MappedBuffer()
+{
+	const auto fd{::open(path.c_str(), O_RDONLY | O_CLOEXEC)};
+
+	if (fd == -1)
+	{
+		throw std::system_error(errno, std::generic_category(), "open");
+	}
+
+	struct stat fileStat{};
+
+	if (::fstat(fd, &fileStat) == -1)
+	{
+		const auto error{errno};
+		::close(fd);
+		throw std::system_error(error, std::generic_category(), "fstat");
+	}
+
+	const auto fileSize{static_cast<std::size_t>(fileStat.st_size)};
+
+	if (offset > fileSize || (length != toEnd && length > fileSize - offset))
+	{
+		::close(fd);
+		throw std::out_of_range("mapped region exceeds file size");
+	}
+
+	dataSize_ = length == toEnd ? fileSize - offset : length;
+
+	if (dataSize_ == 0)
+	{
+		::close(fd);
+		return;
+	}
+
+	// mmap requires a page aligned offset, the bytes before the requested offset are skipped
+	const auto pageSize{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+	const auto alignedOffset{offset / pageSize * pageSize};
+	mappingSize_ = dataSize_ + (offset - alignedOffset);
+	mapping_ = ::mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, static_cast<off_t>(alignedOffset));
+	const auto error{errno};
+	::close(fd);
+
+	if (mapping_ == MAP_FAILED)
+	{
+		mapping_ = nullptr;
+		mappingSize_ = 0;
+		dataSize_ = 0;
+		throw std::system_error(error, std::generic_category(), "mmap");
+	}
+
+	data_ = static_cast<const std::byte*>(mapping_) + (offset - alignedOffset);
+}
+
+MappedBuffer::MappedBuffer(MappedBuffer&& obj) noexcept : MappedBuffer()
+{
+	std::swap(mapping_, obj.mapping_);
+	std::swap(mappingSize_, obj.mappingSize_);
+	std::swap(data_, obj.data_);
+	std::swap(dataSize_, obj.dataSize_);
+}
+
+MappedBuffer& MappedBuffer::operator=(MappedBuffer&& obj) noexcept
+{
+	if (this != &obj)
+	{
+		destroy();
+
+		std::swap(mapping_, obj.mapping_);
+		std::swap(mappingSize_, obj.mappingSize_);
+		std::swap(data_, obj.data_);
+		std::swap(dataSize_, obj.dataSize_);
+	}
+
+	return *this;
+}
+
+MappedBuffer::~MappedBuffer()
+{
+	destroy();
+}
+
+void MappedBuffer::advise(AccessHint hint) const
+{
+	if (!mapping_)
+	{
+		return;
+	}
+
+	auto advice{MADV_NORMAL};
+
+	switch (hint)
+	{
+		case AccessHint::normal:
+			break;
+		case AccessHint::sequential:
+			advice = MADV_SEQUENTIAL;
+			break;
+		case AccessHint::random:
+			advice = MADV_RANDOM;
+			break;
+		case AccessHint::willneed:
+			advice = MADV_WILLNEED;
+			break;
+	}
+
+	if (::madvise(mapping_, mappingSize_, advice) == -1)
+	{
+		throw std::system_error(errno, std::generic_category(), "madvise");
+	}
+}
+
+std::span<const std::byte> MappedBuffer::data() const noexcept
+{
+	return {data_, dataSize_};
+}
+
+std::size_t MappedBuffer::size() const noexcept
+{
+	return dataSize_;
+}
+
+bool MappedBuffer::empty() const noexcept
+{
+	return dataSize_ == 0;
+}
+
+void MappedBuffer::destroy() noexcept
+{
+	if (mapping_)
+	{
+		::munmap(mapping_, mappingSize_);
+	}
+
+	mapping_ = nullptr;
+	mappingSize_ = 0;
+	data_ = nullptr;
+	dataSize_ = 0;
+}
+} // namespace byte_buffer
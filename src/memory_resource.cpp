@@ -0,0 +1,133 @@
+#include <algorithm>
+#include <cerrno>
+#include <new>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <system_error>
+#include <unistd.h>
+#include <vector>
+
+#include "../include/byte_buffer/memory_resource.hpp"
+
+namespace byte_buffer
+{
+namespace
+{
+std::pmr::monotonic_buffer_resource& threadArena()
+{
+	thread_local std::pmr::monotonic_buffer_resource arena;
+	return arena;
+}
+
+std::size_t roundUp(std::size_t size, std::size_t granularity) noexcept
+{
+	return (size + granularity - 1) / granularity * granularity;
+}
+
+void bindToNode(void* data, std::size_t size, int node)
+{
+	constexpr int mpolBind{2};
+	constexpr std::size_t maskBits{8 * sizeof(unsigned long)};
+
+	std::vector<unsigned long> nodeMask(static_cast<std::size_t>(node) / maskBits + 1);
+	nodeMask.back() |= 1UL << (static_cast<std::size_t>(node) % maskBits);
+
+	// the kernel expects one more than the number of bits in the mask
+	if (::syscall(SYS_mbind, data, size, mpolBind, nodeMask.data(), nodeMask.size() * maskBits + 1, 0) == -1)
+	{
+		throw std::system_error(errno, std::generic_category(), "mbind");
+	}
+}
+} // namespace
+
+std::pmr::memory_resource* thread_arena_resource()
+{
+	return &threadArena();
+}
+
+void release_thread_arena()
+{
+	threadArena().release();
+}
+
+std::pmr::memory_resource* thread_pool_resource()
+{
+	thread_local std::pmr::unsynchronized_pool_resource pool;
+	return &pool;
+}
+
+PageResource::PageResource(PageOptions options) noexcept : options_{options} {}
+
+const PageOptions& PageResource::options() const noexcept
+{
+	return options_;
+}
+
+void* PageResource::do_allocate(std::size_t bytes, std::size_t alignment)
+{
+	const auto granularity{this->granularity()};
+	const auto size{roundUp(std::max<std::size_t>(bytes, 1), granularity)};
+	alignment = std::max(alignment, granularity);
+
+	// stricter alignments are carved out of a larger mapping whose head and tail are unmapped
+	const auto mappingSize{size + alignment - granularity};
+	const auto flags{MAP_PRIVATE | MAP_ANONYMOUS | (options_.hugePages == HugePages::reserved ? MAP_HUGETLB : 0)};
+	const auto mapping{::mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, flags, -1, 0)};
+
+	if (mapping == MAP_FAILED)
+	{
+		throw std::bad_alloc();
+	}
+
+	const auto address{reinterpret_cast<std::uintptr_t>(mapping)};
+	const auto alignedAddress{(address + alignment - 1) & ~(alignment - 1)};
+	const auto data{reinterpret_cast<void*>(alignedAddress)};
+
+	if (alignedAddress != address)
+	{
+		::munmap(mapping, alignedAddress - address);
+	}
+
+	if (const auto tailSize{address + mappingSize - (alignedAddress + size)}; tailSize)
+	{
+		::munmap(reinterpret_cast<void*>(alignedAddress + size), tailSize);
+	}
+
+	// the advice fails only when transparent huge pages are disabled, regular pages are used then
+	if (options_.hugePages == HugePages::transparent)
+	{
+		::madvise(data, size, MADV_HUGEPAGE);
+	}
+
+	if (options_.numaNode >= 0)
+	{
+		try
+		{
+			bindToNode(data, size, options_.numaNode);
+		}
+		catch (...)
+		{
+			::munmap(data, size);
+			throw;
+		}
+	}
+
+	return data;
+}
+
+void PageResource::do_deallocate(void* p, std::size_t bytes, std::size_t)
+{
+	::munmap(p, roundUp(std::max<std::size_t>(bytes, 1), granularity()));
+}
+
+bool PageResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+	return this == &other;
+}
+
+std::size_t PageResource::granularity() const noexcept
+{
+	static const auto pageSize{static_cast<std::size_t>(::sysconf(_SC_PAGESIZE))};
+	return options_.hugePages == HugePages::none ? pageSize : hugePageSize;
+}
+} // namespace byte_buffer
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <cerrno>
+#include <sys/mman.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+#include "../include/byte_buffer/mirrored_memory.hpp"
+
+namespace byte_buffer
+{
+MirroredMemory::MirroredMemory() noexcept : data_{}, size_{} {}
+
+MirroredMemory::MirroredMemory(BufferSize size) : MirroredMemory()
+{
+	const auto pageSize{static_cast<BufferSize>(::sysconf(_SC_PAGESIZE))};
+	size = std::max<BufferSize>((size + pageSize - 1) / pageSize * pageSize, pageSize);
+
+	const auto fd{::memfd_create("byte_buffer_mirror", MFD_CLOEXEC)};
+
+	if (fd == -1)
+	{
+		throw std::system_error(errno, std::generic_category(), "memfd_create");
+	}
+
+	if (::ftruncate(fd, static_cast<off_t>(size)) == -1)
+	{
+		const auto error{errno};
+		::close(fd);
+		throw std::system_error(error, std::generic_category(), "ftruncate");
+	}
+
+	// reserve twice the size of address space, then map the same pages into both halves
+	auto base{::mmap(nullptr, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)};
+
+	if (base == MAP_FAILED)
+	{
+		const auto error{errno};
+		::close(fd);
+		throw std::system_error(error, std::generic_category(), "mmap");
+	}
+
+	const auto data{static_cast<std::byte*>(base)};
+
+	for (const auto half : {data, data + size})
+	{
+		if (::mmap(half, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+		{
+			const auto error{errno};
+			::munmap(base, 2 * size);
+			::close(fd);
+			throw std::system_error(error, std::generic_category(), "mmap");
+		}
+	}
+
+	::close(fd);
+
+	data_ = data;
+	size_ = size;
+}
+
+MirroredMemory::MirroredMemory(MirroredMemory&& obj) noexcept : MirroredMemory()
+{
+	std::swap(data_, obj.data_);
+	std::swap(size_, obj.size_);
+}
+
+MirroredMemory& MirroredMemory::operator=(MirroredMemory&& obj) noexcept
+{
+	if (this != &obj)
+	{
+		destroy();
+
+		std::swap(data_, obj.data_);
+		std::swap(size_, obj.size_);
+	}
+
+	return *this;
+}
+
+MirroredMemory::~MirroredMemory()
+{
+	destroy();
+}
+
+std::byte* MirroredMemory::data() const noexcept
+{
+	return data_;
+}
+
+BufferSize MirroredMemory::size() const noexcept
+{
+	return size_;
+}
+
+void MirroredMemory::destroy() noexcept
+{
+	if (data_)
+	{
+		::munmap(data_, 2 * size_);
+	}
+
+	data_ = nullptr;
+	size_ = 0;
+}
+} // namespace byte_buffer
@@ -0,0 +1,260 @@
+#include <algorithm>
+
+#include "../include/byte_buffer/kernels.hpp"
+#include "../include/byte_buffer/parallel.hpp"
+
+namespace byte_buffer
+{
+namespace
+{
+std::atomic<bool> parallelCopyNonTemporal{};
+} // namespace
+
+ThreadPool::ThreadPool(std::size_t threadCount, std::size_t chunkSize)
+	: chunkSize_{std::max<std::size_t>(chunkSize, 1)}, generation_{}, busyWorkers_{}, stopping_{}, size_{}, context_{}, function_{}
+{
+	if (!threadCount)
+	{
+		threadCount = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+
+	ranges_ = std::make_unique<WorkRange[]>(threadCount);
+	workers_.reserve(threadCount - 1);
+
+	try
+	{
+		for (std::size_t i{1}; i < threadCount; ++i)
+		{
+			workers_.emplace_back(&ThreadPool::workerLoop, this, i);
+		}
+	}
+	catch (...)
+	{
+		stop();
+		throw;
+	}
+}
+
+ThreadPool::~ThreadPool()
+{
+	stop();
+}
+
+std::size_t ThreadPool::thread_count() const noexcept
+{
+	return workers_.size() + 1;
+}
+
+void ThreadPool::copy(std::span<std::byte> destination, std::span<const std::byte> source, bool nonTemporal)
+{
+	forEachChunk(source.size(), [&](std::size_t, std::size_t offset, std::size_t size) {
+		if (nonTemporal)
+		{
+			kernels::copy_non_temporal(destination.subspan(offset, size), source.subspan(offset, size));
+		}
+		else
+		{
+			std::memcpy(destination.data() + offset, source.data() + offset, size);
+		}
+	});
+}
+
+void ThreadPool::fill(std::span<std::byte> destination, std::byte value, bool nonTemporal)
+{
+	forEachChunk(destination.size(), [&](std::size_t, std::size_t offset, std::size_t size) {
+		if (nonTemporal)
+		{
+			kernels::fill_non_temporal(destination.subspan(offset, size), value);
+		}
+		else
+		{
+			std::memset(destination.data() + offset, std::to_integer<int>(value), size);
+		}
+	});
+}
+
+uint32_t ThreadPool::crc32c(std::span<const std::byte> data, uint32_t crc)
+{
+	std::vector<uint32_t> chunkCrcs((data.size() + chunkSize_ - 1) / chunkSize_);
+
+	forEachChunk(data.size(), [&](std::size_t chunk, std::size_t offset, std::size_t size) {
+		chunkCrcs[chunk] = kernels::crc32c(data.subspan(offset, size));
+	});
+
+	for (std::size_t i{}; i < chunkCrcs.size(); ++i)
+	{
+		crc = kernels::crc32c_combine(crc, chunkCrcs[i], std::min(chunkSize_, data.size() - i * chunkSize_));
+	}
+
+	return crc;
+}
+
+void ThreadPool::run(std::size_t size, const void* context, ChunkFunction function)
+{
+	const auto chunkCount{(size + chunkSize_ - 1) / chunkSize_};
+
+	if (chunkCount <= 1 || workers_.empty())
+	{
+		for (std::size_t chunk{}; chunk < chunkCount; ++chunk)
+		{
+			const auto offset{chunk * chunkSize_};
+			function(context, chunk, offset, std::min(chunkSize_, size - offset));
+		}
+
+		return;
+	}
+
+	const std::lock_guard submitLock(submitMutex_);
+	const auto threadCount{thread_count()};
+
+	// every thread starts with a contiguous range of chunks, so it streams through its own part of the memory
+	for (std::size_t i{}; i < threadCount; ++i)
+	{
+		ranges_[i].begin = chunkCount * i / threadCount;
+		ranges_[i].end = chunkCount * (i + 1) / threadCount;
+	}
+
+	{
+		const std::lock_guard lock(mutex_);
+		size_ = size;
+		context_ = context;
+		function_ = function;
+		busyWorkers_ = workers_.size();
+		++generation_;
+	}
+
+	wake_.notify_all();
+	work(0);
+
+	// the operation state lives on the stack of the caller, so the workers must leave it first
+	std::unique_lock lock(mutex_);
+	done_.wait(lock, [this] { return !busyWorkers_; });
+}
+
+void ThreadPool::stop() noexcept
+{
+	{
+		const std::lock_guard lock(mutex_);
+		stopping_ = true;
+	}
+
+	wake_.notify_all();
+
+	for (auto& worker : workers_)
+	{
+		worker.join();
+	}
+
+	workers_.clear();
+}
+
+void ThreadPool::work(std::size_t self) noexcept
+{
+	for (std::size_t chunk; take(self, chunk);)
+	{
+		const auto offset{chunk * chunkSize_};
+		function_(context_, chunk, offset, std::min(chunkSize_, size_ - offset));
+	}
+}
+
+bool ThreadPool::take(std::size_t self, std::size_t& chunk) noexcept
+{
+	auto& own{ranges_[self]};
+
+	{
+		const std::lock_guard lock(own.mutex);
+
+		if (own.begin < own.end)
+		{
+			chunk = own.begin++;
+			return true;
+		}
+	}
+
+	const auto threadCount{thread_count()};
+
+	for (std::size_t i{1}; i < threadCount; ++i)
+	{
+		auto& victim{ranges_[(self + i) % threadCount]};
+		std::size_t begin;
+		std::size_t end;
+
+		{
+			const std::lock_guard lock(victim.mutex);
+
+			if (victim.begin == victim.end)
+			{
+				continue;
+			}
+
+			// the upper half is stolen, the victim keeps streaming through the lower one
+			begin = victim.begin + (victim.end - victim.begin) / 2;
+			end = victim.end;
+			victim.end = begin;
+		}
+
+		const std::lock_guard lock(own.mutex);
+		chunk = begin;
+		own.begin = begin + 1;
+		own.end = end;
+
+		return true;
+	}
+
+	return false;
+}
+
+void ThreadPool::workerLoop(std::size_t self) noexcept
+{
+	uint64_t generation{};
+
+	for (;;)
+	{
+		{
+			std::unique_lock lock(mutex_);
+			wake_.wait(lock, [&] { return stopping_ || generation_ != generation; });
+
+			if (stopping_)
+			{
+				return;
+			}
+
+			generation = generation_;
+		}
+
+		work(self);
+
+		const std::lock_guard lock(mutex_);
+
+		if (!--busyWorkers_)
+		{
+			done_.notify_one();
+		}
+	}
+}
+
+ThreadPool& default_thread_pool()
+{
+	static ThreadPool pool;
+	return pool;
+}
+
+void set_parallel_copy_policy(const ParallelCopyPolicy& policy) noexcept
+{
+	parallelCopyNonTemporal.store(policy.nonTemporal, std::memory_order_relaxed);
+	detail::parallelCopyThreshold.store(policy.threshold, std::memory_order_relaxed);
+}
+
+ParallelCopyPolicy parallel_copy_policy() noexcept
+{
+	return {detail::parallelCopyThreshold.load(std::memory_order_relaxed), parallelCopyNonTemporal.load(std::memory_order_relaxed)};
+}
+
+namespace detail
+{
+void parallel_copy(std::byte* destination, const std::byte* source, std::size_t size)
+{
+	default_thread_pool().copy({destination, size}, {source, size}, parallelCopyNonTemporal.load(std::memory_order_relaxed));
+}
+} // namespace detail
+} // namespace byte_buffer
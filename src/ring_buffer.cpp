@@ -0,0 +1,95 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+#include "../include/byte_buffer/ring_buffer.hpp"
+
+namespace byte_buffer
+{
+RingBuffer::RingBuffer() noexcept : memory_{}, readPosition_{}, writePosition_{} {}
+
+RingBuffer::RingBuffer(BufferSize capacity) : memory_{capacity}, readPosition_{}, writePosition_{} {}
+
+RingBuffer::RingBuffer(RingBuffer&& obj) noexcept
+	: memory_{std::move(obj.memory_)}, readPosition_{std::exchange(obj.readPosition_, 0)}, writePosition_{std::exchange(obj.writePosition_, 0)}
+{
+}
+
+RingBuffer& RingBuffer::operator=(RingBuffer&& obj) noexcept
+{
+	if (this != &obj)
+	{
+		memory_ = std::move(obj.memory_);
+		readPosition_ = std::exchange(obj.readPosition_, 0);
+		writePosition_ = std::exchange(obj.writePosition_, 0);
+	}
+
+	return *this;
+}
+
+std::span<const std::byte> RingBuffer::readable() const noexcept
+{
+	return memory_.data() ? std::span<const std::byte>{memory_.data() + readPosition_ % memory_.size(), size()} : std::span<const std::byte>{};
+}
+
+std::span<std::byte> RingBuffer::writable() noexcept
+{
+	return memory_.data() ? std::span<std::byte>{memory_.data() + writePosition_ % memory_.size(), memory_.size() - size()} : std::span<std::byte>{};
+}
+
+void RingBuffer::commit(BufferSize size)
+{
+	if (size > memory_.size() - this->size())
+	{
+		throw std::out_of_range("committed size exceeds the ring buffer free space");
+	}
+
+	writePosition_ += size;
+}
+
+void RingBuffer::consume(BufferSize size)
+{
+	if (size > this->size())
+	{
+		throw std::out_of_range("consumed size exceeds the ring buffer data size");
+	}
+
+	readPosition_ += size;
+}
+
+BufferSize RingBuffer::write(std::span<const std::byte> bytes) noexcept
+{
+	const auto space{writable()};
+	const auto size{std::min<BufferSize>(space.size(), bytes.size())};
+
+	if (size)
+	{
+		std::memcpy(space.data(), bytes.data(), size);
+		writePosition_ += size;
+	}
+
+	return size;
+}
+
+BufferSize RingBuffer::size() const noexcept
+{
+	return static_cast<BufferSize>(writePosition_ - readPosition_);
+}
+
+BufferSize RingBuffer::capacity() const noexcept
+{
+	return memory_.size();
+}
+
+bool RingBuffer::empty() const noexcept
+{
+	return readPosition_ == writePosition_;
+}
+
+void RingBuffer::clear() noexcept
+{
+	readPosition_ = 0;
+	writePosition_ = 0;
+}
+} // namespace byte_buffer
@@ -0,0 +1,113 @@
+#include <atomic>
+#include <stdexcept>
+
+#include "../include/byte_buffer/shared_buffer.hpp"
+
+namespace byte_buffer
+{
+SharedBuffer::SharedBuffer() noexcept : storage_{}, offset_{}, size_{} {}
+
+SharedBuffer::SharedBuffer(std::span<const std::byte> bytes) : SharedBuffer(Buffer(bytes)) {}
+
+SharedBuffer::SharedBuffer(Buffer&& buffer) : storage_{std::make_shared<Buffer>(std::move(buffer))}, offset_{}, size_{storage_->size()} {}
+
+SharedBuffer SharedBuffer::slice(BufferSize offset, BufferSize size) const
+{
+	if (offset > size_ || size > size_ - offset)
+	{
+		throw std::out_of_range("slice exceeds buffer size");
+	}
+
+	SharedBuffer part(*this);
+	part.offset_ += offset;
+	part.size_ = size;
+
+	return part;
+}
+
+void SharedBuffer::overwrite(std::span<const std::byte> bytes)
+{
+	if (!storage_ || !unique())
+	{
+		storage_ = std::make_shared<Buffer>(bytes);
+	}
+	else
+	{
+		storage_->overwrite(bytes);
+	}
+
+	offset_ = 0;
+	size_ = storage_->size();
+}
+
+void SharedBuffer::append(std::span<const std::byte> bytes)
+{
+	// the bytes may point into the current storage, so it stays alive until they are appended
+	std::shared_ptr<Buffer> previous;
+
+	if (!storage_ || !unique() || offset_ != 0)
+	{
+		previous = storage_;
+		detach(bytes.size());
+	}
+
+	// a unique storage may still hold bytes past the view, left from a slice
+	storage_->resize_uninitialized(size_);
+	storage_->append(bytes);
+	size_ = storage_->size();
+}
+
+std::span<const std::byte> SharedBuffer::data() const noexcept
+{
+	return storage_ ? storage_->data().subspan(offset_, size_) : std::span<const std::byte>{};
+}
+
+BufferSize SharedBuffer::size() const noexcept
+{
+	return size_;
+}
+
+bool SharedBuffer::empty() const noexcept
+{
+	return size_ == 0;
+}
+
+bool SharedBuffer::unique() const noexcept
+{
+	if (!storage_ || storage_.use_count() > 1)
+	{
+		return !storage_;
+	}
+
+	// `use_count` is a relaxed load, the fence orders the writes of the instances released before
+	// by other threads ahead of the modifications done in place
+	std::atomic_thread_fence(std::memory_order_acquire);
+
+	return true;
+}
+
+void SharedBuffer::clear() noexcept
+{
+	if (unique() && storage_)
+	{
+		storage_->clear();
+	}
+	else
+	{
+		storage_.reset();
+	}
+
+	offset_ = 0;
+	size_ = 0;
+}
+
+void SharedBuffer::detach(BufferSize extraCapacity)
+{
+	auto storage{storage_ ? std::make_shared<Buffer>(storage_->growth_policy(), storage_->resource()) : std::make_shared<Buffer>()};
+	storage->reserve(size_ + extraCapacity);
+	storage->append(data());
+
+	storage_ = std::move(storage);
+	offset_ = 0;
+}
+} // namespace byte_buffer
@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <system_error>
+#include <unistd.h>
+#include <vector>
+
+#include "../include/byte_buffer/async_io.hpp"
+
+namespace
+{
+constexpr auto fileName{"async_io_test"};
+
+std::vector<std::byte> testData(std::size_t size)
+{
+	std::vector<std::byte> data(size);
+
+	for (auto i{0u}; i < size; ++i)
+	{
+		data[i] = std::byte(i * 13);
+	}
+
+	return data;
+}
+
+byte_buffer::Task<> writeAndClose(const byte_buffer::Buffer& buffer, int fd)
+{
+	co_await buffer.async_write(fd);
+	::close(fd);
+}
+
+byte_buffer::Task<byte_buffer::BufferSize> readAll(byte_buffer::Buffer& buffer, int fd, byte_buffer::BufferSize size)
+{
+	co_return co_await buffer.async_append(fd, size);
+}
+
+byte_buffer::Task<> echo(int fd, byte_buffer::BufferSize size)
+{
+	byte_buffer::Buffer buffer;
+	co_await readAll(buffer, fd, size);
+	co_await buffer.async_write(fd);
+}
+} // namespace
+
+TEST(async_io_unit_tests, pipe_larger_than_capacity)
+{
+	// the pipe holds less than the data, so both ends suspend repeatedly
+	const auto someData{testData(1 << 20)};
+	const byte_buffer::Buffer source(someData);
+	byte_buffer::Buffer sink;
+	byte_buffer::BufferSize bytesRead{};
+
+	int fds[2];
+	ASSERT_EQ(::pipe2(fds, O_NONBLOCK | O_CLOEXEC), 0);
+
+	auto& loop{byte_buffer::thread_event_loop()};
+	loop.spawn([](byte_buffer::Buffer& sink, int fd, byte_buffer::BufferSize& bytesRead) -> byte_buffer::Task<> {
+		// reads past the data size, so the read ends at the end of file
+		bytesRead = co_await readAll(sink, fd, 2 << 20);
+	}(sink, fds[0], bytesRead));
+	loop.spawn(writeAndClose(source, fds[1]));
+	loop.run();
+
+	::close(fds[0]);
+
+	ASSERT_EQ(bytesRead, someData.size());
+	ASSERT_TRUE(std::equal(someData.begin(), someData.end(), sink.data().begin()));
+}
+
+TEST(async_io_unit_tests, unix_socket_echo)
+{
+	const auto someData{testData(300000)};
+	const byte_buffer::Buffer request(someData);
+	byte_buffer::Buffer response;
+
+	int fds[2];
+	ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, fds), 0);
+
+	byte_buffer::EventLoop loop;
+	loop.spawn(echo(fds[1], someData.size()));
+	loop.spawn([](const byte_buffer::Buffer& request, byte_buffer::Buffer& response, int fd) -> byte_buffer::Task<> {
+		co_await request.async_write(fd);
+		co_await response.async_append(fd, request.size());
+	}(request, response, fds[0]));
+
+	// the operations wait on the loop running their tasks, not on the thread-local default loop
+	loop.run();
+
+	::close(fds[0]);
+	::close(fds[1]);
+
+	ASSERT_EQ(response.size(), someData.size());
+	ASSERT_TRUE(std::equal(someData.begin(), someData.end(), response.data().begin()));
+}
+
+TEST(async_io_unit_tests, regular_file_completes_without_suspending)
+{
+	const auto someData{testData(100000)};
+
+	{
+		std::ofstream file(fileName, std::ios::binary);
+		file.write(reinterpret_cast<const char*>(someData.data()), someData.size());
+	}
+
+	const auto fd{::open(fileName, O_RDONLY | O_CLOEXEC)};
+	ASSERT_NE(fd, -1);
+
+	byte_buffer::Buffer buffer;
+	auto& loop{byte_buffer::thread_event_loop()};
+	loop.spawn([](byte_buffer::Buffer& buffer, int fd) -> byte_buffer::Task<> {
+		co_await buffer.async_append(fd, 1000);
+		co_await buffer.async_append(fd, 1 << 20);
+	}(buffer, fd));
+
+	// epoll rejects regular files, the reads completed within spawn
+	ASSERT_EQ(buffer.size(), someData.size());
+	loop.run();
+
+	::close(fd);
+	std::filesystem::remove(fileName);
+
+	ASSERT_TRUE(std::equal(someData.begin(), someData.end(), buffer.data().begin()));
+}
+
+TEST(async_io_unit_tests, errors_are_rethrown_by_run)
+{
+	int fds[2];
+	ASSERT_EQ(::pipe2(fds, O_NONBLOCK | O_CLOEXEC), 0);
+
+	byte_buffer::Buffer buffer;
+	byte_buffer::EventLoop loop;
+	loop.spawn([](byte_buffer::Buffer& buffer, int fd) -> byte_buffer::Task<> {
+		// reading from the write end of a pipe fails
+		co_await buffer.async_append(fd, 100);
+	}(buffer, fds[1]));
+
+	ASSERT_THROW(loop.run(), std::system_error);
+
+	// a failing task does not stop the others
+	loop.spawn(writeAndClose(buffer, fds[1]));
+	loop.spawn([](byte_buffer::Buffer& buffer, int fd) -> byte_buffer::Task<> {
+		co_await buffer.async_append(fd, 100);
+	}(buffer, fds[0]));
+	loop.run();
+
+	::close(fds[0]);
+}
+
+int main(int argc, char** argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,126 @@
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <new>
+#include <unistd.h>
+
+#include "../include/byte_buffer/buffer_chain.hpp"
+
+namespace
+{
+constexpr std::byte headerData[]{std::byte{0x1}, std::byte{0x2}};
+constexpr std::byte bodyData[]{std::byte{0x3}, std::byte{0x4}, std::byte{0x5}};
+constexpr std::byte trailerData[]{std::byte{0x6}};
+constexpr std::byte expectedData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}, std::byte{0x4}, std::byte{0x5}, std::byte{0x6}};
+constexpr auto expectedDataSize{std::size(expectedData)};
+
+byte_buffer::BufferChain makeMessage()
+{
+	byte_buffer::BufferChain chain;
+	chain.append(byte_buffer::Buffer({bodyData, std::size(bodyData)}));
+	chain.append(byte_buffer::Buffer({trailerData, std::size(trailerData)}));
+	chain.prepend(byte_buffer::Buffer({headerData, std::size(headerData)}));
+
+	return chain;
+}
+} // namespace
+
+TEST(buffer_chain_unit_tests, default_construct)
+{
+	const byte_buffer::BufferChain chain;
+
+	ASSERT_EQ(chain.size(), 0);
+	ASSERT_TRUE(chain.empty());
+	ASSERT_TRUE(chain.segments().empty());
+	ASSERT_TRUE(chain.iovecs().empty());
+}
+
+TEST(buffer_chain_unit_tests, append_and_prepend)
+{
+	const auto chain{makeMessage()};
+
+	ASSERT_EQ(chain.size(), expectedDataSize);
+	ASSERT_EQ(chain.segments().size(), 3);
+	ASSERT_EQ(std::memcmp(headerData, chain.segments()[0].data().data(), std::size(headerData)), 0);
+	ASSERT_EQ(std::memcmp(trailerData, chain.segments()[2].data().data(), std::size(trailerData)), 0);
+}
+
+TEST(buffer_chain_unit_tests, iovecs)
+{
+	auto chain{makeMessage()};
+	chain.append(byte_buffer::Buffer());
+
+	const auto iov{chain.iovecs()};
+
+	ASSERT_EQ(iov.size(), 3);
+	ASSERT_EQ(iov[0].iov_base, chain.segments()[0].data().data());
+	ASSERT_EQ(iov[1].iov_len, std::size(bodyData));
+}
+
+TEST(buffer_chain_unit_tests, write_to_file_descriptor)
+{
+	constexpr auto fileName{"test"};
+	const auto chain{makeMessage()};
+
+	auto fd{::open(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644)};
+	chain.write_to(fd);
+	::close(fd);
+
+	byte_buffer::Buffer buffer;
+	fd = ::open(fileName, O_RDONLY);
+	buffer.read_from(fd, 2 * expectedDataSize);
+	::close(fd);
+
+	ASSERT_EQ(buffer.size(), expectedDataSize);
+	ASSERT_EQ(std::memcmp(expectedData, buffer.data().data(), expectedDataSize), 0);
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(buffer_chain_unit_tests, flatten)
+{
+	auto chain{makeMessage()};
+	const auto& flat{chain.flatten()};
+
+	ASSERT_EQ(chain.segments().size(), 1);
+	ASSERT_EQ(chain.size(), expectedDataSize);
+	ASSERT_EQ(flat.size(), expectedDataSize);
+	ASSERT_EQ(std::memcmp(expectedData, flat.data().data(), expectedDataSize), 0);
+
+	const auto flatData{flat.data().data()};
+
+	ASSERT_EQ(chain.flatten().data().data(), flatData);
+}
+
+TEST(buffer_chain_unit_tests, failed_flatten_keeps_segments)
+{
+	constexpr std::byte someData[100]{std::byte{0x1}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	// the first segment cannot grow, so flattening fails
+	std::byte arena[256];
+	std::pmr::monotonic_buffer_resource resource(arena, sizeof(arena), std::pmr::null_memory_resource());
+
+	byte_buffer::BufferChain chain;
+	chain.append(byte_buffer::Buffer({someData, someDataSize}, &resource));
+	chain.append(byte_buffer::Buffer({someData, someDataSize}));
+	chain.append(byte_buffer::Buffer({someData, someDataSize}));
+
+	ASSERT_THROW((void)chain.flatten(), std::bad_alloc);
+	ASSERT_EQ(chain.size(), 3 * someDataSize);
+	ASSERT_EQ(chain.segments().size(), 3);
+
+	for (const auto& segment : chain.segments())
+	{
+		ASSERT_EQ(segment.size(), someDataSize);
+		ASSERT_EQ(std::memcmp(segment.data().data(), someData, someDataSize), 0);
+	}
+}
+
+int main(int argc, char** argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,187 @@
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+#include "../include/byte_buffer/buffer_cursor.hpp"
+
+static_assert(byte_buffer::Scalar<char> && byte_buffer::Scalar<double> && !byte_buffer::Scalar<bool> && !byte_buffer::Scalar<long double>);
+
+TEST(buffer_cursor_unit_tests, write_little_endian)
+{
+	constexpr std::byte expectedData[]{std::byte{0x1}, std::byte{0x3}, std::byte{0x2}, std::byte{0x7}, std::byte{0x6}, std::byte{0x5}, std::byte{0x4}};
+	constexpr auto expectedDataSize{std::size(expectedData)};
+
+	byte_buffer::Buffer buffer;
+
+	{
+		byte_buffer::BufferWriter writer(buffer);
+		writer.write(uint8_t{0x1});
+		writer.write(uint16_t{0x0203});
+		writer.write(uint32_t{0x04050607});
+	}
+
+	ASSERT_EQ(buffer.size(), expectedDataSize);
+	ASSERT_EQ(std::memcmp(expectedData, buffer.data().data(), expectedDataSize), 0);
+}
+
+TEST(buffer_cursor_unit_tests, write_big_endian)
+{
+	constexpr std::byte expectedData[]{std::byte{0x2}, std::byte{0x3}, std::byte{0x4}, std::byte{0x5}, std::byte{0x6}, std::byte{0x7}};
+	constexpr auto expectedDataSize{std::size(expectedData)};
+
+	byte_buffer::Buffer buffer;
+	byte_buffer::BufferWriter<std::endian::big> writer(buffer);
+	writer.reserve(expectedDataSize);
+	writer.write(uint16_t{0x0203});
+	writer.write(uint32_t{0x04050607});
+
+	ASSERT_TRUE(buffer.empty());
+
+	writer.flush();
+
+	ASSERT_EQ(buffer.size(), expectedDataSize);
+	ASSERT_EQ(std::memcmp(expectedData, buffer.data().data(), expectedDataSize), 0);
+}
+
+TEST(buffer_cursor_unit_tests, varint_encoding)
+{
+	constexpr std::byte expectedData[]{std::byte{0xe5}, std::byte{0x8e}, std::byte{0x26}, std::byte{0xc0}, std::byte{0xbb}, std::byte{0x78}};
+	constexpr auto expectedDataSize{std::size(expectedData)};
+
+	byte_buffer::Buffer buffer;
+
+	{
+		byte_buffer::BufferWriter writer(buffer);
+		writer.write_varint(624485);
+		writer.write_signed_varint(-123456);
+	}
+
+	ASSERT_EQ(buffer.size(), expectedDataSize);
+	ASSERT_EQ(std::memcmp(expectedData, buffer.data().data(), expectedDataSize), 0);
+}
+
+TEST(buffer_cursor_unit_tests, write_and_read)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+
+	byte_buffer::Buffer buffer;
+
+	{
+		byte_buffer::BufferWriter<std::endian::big> writer(buffer);
+		writer.reserve(64);
+		writer.write(int16_t{-2});
+		writer.write(3.5);
+		writer.write(1.25f);
+		writer.write_varint(std::numeric_limits<uint64_t>::max());
+		writer.write_signed_varint(std::numeric_limits<int64_t>::min());
+		writer.write_signed_varint(63);
+		writer.write_string("byte buffer");
+		writer.write_bytes({someData, std::size(someData)});
+	}
+
+	byte_buffer::BufferReader<std::endian::big> reader(buffer.data());
+
+	ASSERT_EQ(reader.read<int16_t>(), -2);
+	ASSERT_EQ(reader.read<double>(), 3.5);
+	ASSERT_EQ(reader.read<float>(), 1.25f);
+	ASSERT_EQ(reader.read_varint(), std::numeric_limits<uint64_t>::max());
+	ASSERT_EQ(reader.read_signed_varint(), std::numeric_limits<int64_t>::min());
+	ASSERT_EQ(reader.read_signed_varint(), 63);
+	ASSERT_EQ(reader.read_string(), "byte buffer");
+	ASSERT_EQ(std::memcmp(someData, reader.read_bytes(std::size(someData)).data(), std::size(someData)), 0);
+	ASSERT_EQ(reader.remaining(), 0);
+	ASSERT_EQ(reader.position(), buffer.size());
+}
+
+TEST(buffer_cursor_unit_tests, many_small_writes)
+{
+	constexpr auto valueCount{10000};
+
+	byte_buffer::Buffer buffer;
+
+	{
+		byte_buffer::BufferWriter writer(buffer);
+
+		for (uint32_t i{}; i < valueCount; ++i)
+		{
+			writer.write(i);
+		}
+	}
+
+	ASSERT_EQ(buffer.size(), valueCount * sizeof(uint32_t));
+
+	byte_buffer::BufferReader reader(buffer.data());
+
+	for (uint32_t i{}; i < valueCount; ++i)
+	{
+		ASSERT_EQ(reader.read<uint32_t>(), i);
+	}
+}
+
+TEST(buffer_cursor_unit_tests, read_past_end)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x80}, std::byte{0x5}};
+
+	byte_buffer::BufferReader reader({someData, std::size(someData)});
+
+	ASSERT_THROW((void)reader.read<uint32_t>(), std::out_of_range);
+	ASSERT_EQ(reader.read<uint8_t>(), 1);
+	ASSERT_THROW((void)reader.read_string(), std::out_of_range);
+}
+
+TEST(buffer_cursor_unit_tests, varint_limits)
+{
+	byte_buffer::Buffer buffer;
+
+	{
+		byte_buffer::BufferWriter writer(buffer);
+		writer.write_varint(std::numeric_limits<uint64_t>::max());
+		writer.write_signed_varint(std::numeric_limits<int64_t>::min());
+		writer.write_signed_varint(std::numeric_limits<int64_t>::max());
+	}
+
+	byte_buffer::BufferReader reader(buffer.data());
+
+	ASSERT_EQ(reader.read_varint(), std::numeric_limits<uint64_t>::max());
+	ASSERT_EQ(reader.read_signed_varint(), std::numeric_limits<int64_t>::min());
+	ASSERT_EQ(reader.read_signed_varint(), std::numeric_limits<int64_t>::max());
+}
+
+TEST(buffer_cursor_unit_tests, varint_overflow)
+{
+	std::byte someData[10];
+	std::fill(std::begin(someData), std::end(someData), std::byte{0xff});
+	someData[9] = std::byte{0x02};
+
+	byte_buffer::BufferReader reader({someData, std::size(someData)});
+	ASSERT_THROW((void)reader.read_varint(), std::out_of_range);
+
+	someData[9] = std::byte{0x01};
+	byte_buffer::BufferReader signedReader({someData, std::size(someData)});
+	ASSERT_THROW((void)signedReader.read_signed_varint(), std::out_of_range);
+}
+
+TEST(buffer_cursor_unit_tests, destruction_after_buffer_change)
+{
+	constexpr std::byte someData[100]{};
+
+	byte_buffer::Buffer buffer;
+	auto writer{std::make_unique<byte_buffer::BufferWriter<>>(buffer)};
+	writer->write_bytes({someData, std::size(someData)});
+
+	// the storage no longer holds the written bytes, flushing fails and destruction drops them
+	buffer.shrink_to_fit();
+
+	ASSERT_THROW(writer->flush(), std::out_of_range);
+	ASSERT_NO_THROW(writer.reset());
+	ASSERT_TRUE(buffer.empty());
+}
+
+int main(int argc, char** argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
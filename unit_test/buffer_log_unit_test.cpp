@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/byte_buffer/buffer_log.hpp"
+
+namespace
+{
+constexpr auto fileName{"buffer_log_test"};
+
+std::vector<std::byte> testRecord(std::size_t size)
+{
+	std::vector<std::byte> record(size);
+
+	for (std::size_t i{}; i < size; ++i)
+	{
+		record[i] = std::byte(size + i * 3);
+	}
+
+	return record;
+}
+
+std::vector<std::vector<std::byte>> readRecords(const byte_buffer::BufferLog& log)
+{
+	std::vector<std::vector<std::byte>> records;
+
+	for (const auto payload : log)
+	{
+		records.emplace_back(payload.begin(), payload.end());
+	}
+
+	return records;
+}
+
+class buffer_log_unit_tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		std::filesystem::remove(fileName);
+	}
+
+	void TearDown() override
+	{
+		std::filesystem::remove(fileName);
+	}
+};
+} // namespace
+
+TEST_F(buffer_log_unit_tests, append_and_iterate)
+{
+	const std::vector records{testRecord(0), testRecord(1), testRecord(7), testRecord(8), testRecord(1000)};
+	byte_buffer::BufferLog log(fileName);
+
+	for (const auto& record : records)
+	{
+		log.append(record);
+	}
+
+	ASSERT_EQ(readRecords(log), records);
+
+	// growing the file keeps the mapping in place, so earlier views stay valid
+	const auto firstPayload{*std::next(log.begin(), 4)};
+	log.append(testRecord(3 * byte_buffer::BufferLog::growthStep));
+
+	ASSERT_EQ(firstPayload.data(), (*std::next(log.begin(), 4)).data());
+	ASSERT_TRUE(std::ranges::equal(firstPayload, records.back()));
+	ASSERT_EQ(std::distance(log.begin(), log.end()), records.size() + 1);
+}
+
+TEST_F(buffer_log_unit_tests, reopen)
+{
+	const std::vector records{testRecord(10), testRecord(20)};
+
+	{
+		byte_buffer::BufferLog log(fileName);
+		log.append(records[0]);
+		log.sync(log.append(records[1]));
+	}
+
+	byte_buffer::BufferLog log(fileName);
+
+	ASSERT_EQ(readRecords(log), records);
+
+	log.append(records[0]);
+
+	ASSERT_EQ(std::distance(log.begin(), log.end()), 3);
+}
+
+TEST_F(buffer_log_unit_tests, torn_tail_is_truncated)
+{
+	const std::vector records{testRecord(10), testRecord(20), testRecord(30)};
+	uint64_t secondEnd;
+
+	{
+		byte_buffer::BufferLog log(fileName);
+		log.append(records[0]);
+		secondEnd = log.append(records[1]);
+		log.append(records[2]);
+		log.append(records[0]);
+		log.sync();
+	}
+
+	// a corrupted third record drops it and the record behind it
+	{
+		std::fstream file(fileName, std::ios::in | std::ios::out | std::ios::binary);
+		file.seekp(static_cast<std::streamoff>(secondEnd + byte_buffer::BufferLog::recordHeaderSize + 5));
+		file.put('\x55');
+	}
+
+	{
+		byte_buffer::BufferLog log(fileName);
+
+		ASSERT_EQ(log.size(), secondEnd);
+		ASSERT_EQ(readRecords(log), std::vector(records.begin(), records.begin() + 2));
+
+		log.append(records[2]);
+	}
+
+	// a record cut off by the end of the file is dropped as well
+	std::filesystem::resize_file(fileName, secondEnd + 12);
+	byte_buffer::BufferLog log(fileName);
+
+	ASSERT_EQ(readRecords(log), std::vector(records.begin(), records.begin() + 2));
+}
+
+TEST_F(buffer_log_unit_tests, group_commit)
+{
+	constexpr auto threadCount{4};
+	constexpr auto recordCount{100};
+	byte_buffer::BufferLog log(fileName);
+	std::vector<std::thread> threads;
+
+	for (auto i{0}; i < threadCount; ++i)
+	{
+		threads.emplace_back([&log, i] {
+			for (auto j{0}; j < recordCount; ++j)
+			{
+				log.sync(log.append(testRecord(i * 10 + j % 10)));
+			}
+		});
+	}
+
+	for (auto& thread : threads)
+	{
+		thread.join();
+	}
+
+	const auto records{readRecords(log)};
+
+	ASSERT_EQ(records.size(), threadCount * recordCount);
+	ASSERT_TRUE(std::ranges::all_of(records, [](const auto& record) { return record == testRecord(record.size()); }));
+}
+
+TEST_F(buffer_log_unit_tests, foreign_file_is_rejected)
+{
+	{
+		std::ofstream file(fileName);
+		file << "not a log at all";
+	}
+
+	ASSERT_THROW(byte_buffer::BufferLog log(fileName), std::runtime_error);
+}
+
+TEST_F(buffer_log_unit_tests, zero_header_is_checked)
+{
+	// a zero file is a log torn while being created
+	{
+		std::ofstream file(fileName, std::ios::binary);
+		file << std::string(4096, '\0');
+	}
+
+	{
+		byte_buffer::BufferLog log(fileName);
+		ASSERT_EQ(log.begin(), log.end());
+	}
+
+	// a foreign file starting with zeros must survive
+	{
+		std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+		file << std::string(16, '\0') << "foreign data";
+	}
+
+	ASSERT_THROW(byte_buffer::BufferLog log(fileName), std::runtime_error);
+	ASSERT_EQ(std::filesystem::file_size(fileName), 28);
+}
+
+int main(int argc, char** argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,131 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "../include/byte_buffer/buffer_pool.hpp"
+
+TEST(buffer_pool_unit_tests, acquire_rounds_up_to_size_class)
+{
+	byte_buffer::BufferPool pool;
+
+	const auto buffer{pool.acquire(1000)};
+
+	ASSERT_TRUE(buffer->empty());
+	ASSERT_EQ(buffer->capacity(), 1024);
+	ASSERT_EQ(pool.stats().misses, 1);
+	ASSERT_EQ(pool.stats().hits, 0);
+}
+
+TEST(buffer_pool_unit_tests, released_buffer_is_reused)
+{
+	byte_buffer::BufferPool pool;
+	const std::vector<std::byte> someData(700, std::byte{0x1});
+
+	const std::byte* firstData{};
+
+	{
+		auto buffer{pool.acquire(someData.size())};
+		buffer->append(someData);
+		firstData = buffer->data().data();
+	}
+
+	ASSERT_EQ(pool.stats().retainedBytes, 1024);
+
+	const auto buffer{pool.acquire(600)};
+
+	ASSERT_TRUE(buffer->empty());
+	ASSERT_EQ(buffer->data().data(), firstData);
+	ASSERT_EQ(pool.stats().hits, 1);
+	ASSERT_EQ(pool.stats().misses, 1);
+	ASSERT_EQ(pool.stats().retainedBytes, 0);
+}
+
+TEST(buffer_pool_unit_tests, grown_buffer_serves_smaller_class)
+{
+	byte_buffer::BufferPool pool;
+	const std::vector<std::byte> someData(3000, std::byte{0x1});
+
+	{
+		auto buffer{pool.acquire(200)};
+		buffer->append(someData);
+	}
+
+	// 3000 bytes of capacity satisfy requests up to 2048 bytes
+	ASSERT_GE(pool.acquire(2048)->capacity(), 2048);
+	ASSERT_EQ(pool.stats().hits, 1);
+
+	ASSERT_EQ(pool.acquire(2049)->capacity(), 4096);
+	ASSERT_EQ(pool.stats().misses, 2);
+}
+
+TEST(buffer_pool_unit_tests, retained_memory_is_capped)
+{
+	byte_buffer::BufferPool pool(4096);
+
+	{
+		auto first{pool.acquire(2048)};
+		auto second{pool.acquire(2048)};
+		auto third{pool.acquire(2048)};
+	}
+
+	ASSERT_EQ(pool.stats().retainedBytes, 4096);
+
+	pool.set_max_retained_bytes(2048);
+	ASSERT_EQ(pool.stats().retainedBytes, 2048);
+
+	pool.trim();
+	ASSERT_EQ(pool.stats().retainedBytes, 0);
+
+	ASSERT_EQ(pool.acquire(2048)->capacity(), 2048);
+	ASSERT_EQ(pool.stats().hits, 0);
+}
+
+TEST(buffer_pool_unit_tests, unpooled_sizes)
+{
+	byte_buffer::BufferPool pool;
+
+	{
+		auto small{pool.acquire(10)};
+		auto large{pool.acquire(byte_buffer::BufferPool::maxPooledCapacity + 1)};
+
+		ASSERT_EQ(large->capacity(), byte_buffer::BufferPool::maxPooledCapacity + 1);
+	}
+
+	ASSERT_EQ(pool.stats().retainedBytes, 0);
+	ASSERT_EQ(pool.stats().hits, 1);
+	ASSERT_EQ(pool.stats().misses, 1);
+}
+
+TEST(buffer_pool_unit_tests, released_handle_does_not_return)
+{
+	byte_buffer::BufferPool pool;
+
+	auto handle{pool.acquire(512)};
+	auto movedHandle{std::move(handle)};
+	const auto buffer{movedHandle.release()};
+
+	ASSERT_EQ(buffer.capacity(), 512);
+
+	{
+		const auto dropped{std::move(movedHandle)};
+	}
+
+	ASSERT_EQ(pool.stats().retainedBytes, 0);
+}
+
+TEST(buffer_pool_unit_tests, thread_pools_are_per_thread)
+{
+	auto& pool{byte_buffer::thread_buffer_pool()};
+	ASSERT_EQ(&pool, &byte_buffer::thread_buffer_pool());
+
+	byte_buffer::BufferPool* otherPool{};
+	std::thread([&otherPool] { otherPool = &byte_buffer::thread_buffer_pool(); }).join();
+
+	ASSERT_NE(&pool, otherPool);
+}
+
+int main(int argc, char** argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,112 @@
+#include <bit>
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+#include "../include/byte_buffer/buffer_stats.hpp"
+#include "../include/byte_buffer/byte_buffer.hpp"
+
+namespace
+{
+class buffer_stats_unit_tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		if (!byte_buffer::buffer_stats_enabled)
+		{
+			GTEST_SKIP() << "buffer stats are not enabled";
+		}
+
+		byte_buffer::reset_thread_buffer_stats();
+	}
+};
+} // namespace
+
+TEST_F(buffer_stats_unit_tests, counts_allocations_and_frees)
+{
+	const std::vector<std::byte> someData(1000, std::byte{0x1});
+
+	{
+		byte_buffer::Buffer buffer(someData);
+		buffer.reserve(1024);
+
+		const auto stats{byte_buffer::thread_buffer_stats()};
+
+		ASSERT_EQ(stats.allocations, 2);
+		ASSERT_EQ(stats.frees, 1);
+		ASSERT_EQ(stats.reallocations, 1);
+		ASSERT_EQ(stats.bytesCopied, 2 * someData.size());
+		ASSERT_EQ(stats.liveCapacity, 1024);
+		// both allocations are live while the data is moved
+		ASSERT_EQ(stats.peakCapacity, 1000 + 1024);
+		ASSERT_EQ(stats.allocationSizes[std::bit_width(1000u)], 1);
+		ASSERT_EQ(stats.allocationSizes[std::bit_width(1024u)], 1);
+	}
+
+	const auto stats{byte_buffer::thread_buffer_stats()};
+
+	ASSERT_EQ(stats.frees, 2);
+	ASSERT_EQ(stats.wastedBytes, 24);
+	ASSERT_EQ(stats.liveCapacity, 0);
+	ASSERT_EQ(stats.peakCapacity, 1000 + 1024);
+}
+
+TEST_F(buffer_stats_unit_tests, inline_storage_is_not_counted)
+{
+	const std::vector<std::byte> someData(byte_buffer::Buffer::inlineCapacity, std::byte{0x1});
+
+	{
+		const byte_buffer::Buffer buffer(someData);
+	}
+
+	const auto stats{byte_buffer::thread_buffer_stats()};
+
+	ASSERT_EQ(stats.allocations, 0);
+	ASSERT_EQ(stats.frees, 0);
+	ASSERT_EQ(stats.bytesCopied, someData.size());
+}
+
+TEST_F(buffer_stats_unit_tests, growth_events)
+{
+	byte_buffer::Buffer buffer(byte_buffer::GrowthPolicy::geometric_2);
+	const std::vector<std::byte> someData(100, std::byte{0x1});
+
+	for (auto i{0}; i < 100; ++i)
+	{
+		buffer.append(someData);
+	}
+
+	const auto stats{byte_buffer::thread_buffer_stats()};
+
+	// 100, 200, 400, ..., 12800 bytes
+	ASSERT_EQ(stats.allocations, 8);
+	ASSERT_EQ(stats.reallocations, 7);
+	ASSERT_EQ(stats.peakCapacity, 12800 + 6400);
+}
+
+TEST_F(buffer_stats_unit_tests, counters_are_per_thread)
+{
+	std::thread([] { const byte_buffer::Buffer buffer(std::vector<std::byte>(1000)); }).join();
+
+	ASSERT_EQ(byte_buffer::thread_buffer_stats().allocations, 0);
+}
+
+TEST(buffer_stats_disabled_unit_tests, counters_stay_zero)
+{
+	if (byte_buffer::buffer_stats_enabled)
+	{
+		GTEST_SKIP() << "buffer stats are enabled";
+	}
+
+	const byte_buffer::Buffer buffer(std::vector<std::byte>(1000));
+
+	ASSERT_EQ(byte_buffer::thread_buffer_stats().allocations, 0);
+	ASSERT_EQ(byte_buffer::thread_buffer_stats().bytesCopied, 0);
+}
+
+int main(int argc, char** argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,106 @@
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <new>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../fuzz/buffer_model.hpp"
+#include "../include/byte_buffer/byte_buffer.hpp"
+
+namespace
+{
+constexpr std::size_t iterations{2000};
+constexpr std::size_t maxInputSize{512};
+
+std::vector<uint8_t> randomInput(std::mt19937& generator)
+{
+	std::vector<uint8_t> input(std::uniform_int_distribution<std::size_t>(0, maxInputSize)(generator));
+	std::uniform_int_distribution<unsigned> byte(0, 255);
+
+	for (auto& value : input)
+	{
+		value = static_cast<uint8_t>(byte(generator));
+	}
+
+	return input;
+}
+
+std::vector<std::byte> pattern(std::size_t size)
+{
+	std::vector<std::byte> bytes(size);
+
+	for (std::size_t i{}; i < size; ++i)
+	{
+		bytes[i] = std::byte(i * 7);
+	}
+
+	return bytes;
+}
+} // namespace
+
+// runs random operation sequences against the model, a failure prints the seed to replay
+TEST(buffer_stress_unit_tests, random_operations_match_model)
+{
+	for (uint32_t seed{}; seed < iterations; ++seed)
+	{
+		std::mt19937 generator(seed);
+		const auto input{randomInput(generator)};
+
+		ASSERT_NO_THROW(byte_buffer::fuzz::BufferModel().run(input)) << "seed " << seed;
+	}
+}
+
+TEST(buffer_stress_unit_tests, empty_input)
+{
+	ASSERT_NO_THROW(byte_buffer::fuzz::BufferModel().run({}));
+}
+
+TEST(buffer_stress_unit_tests, append_own_data_while_growing)
+{
+	const auto bytes{pattern(byte_buffer::Buffer::inlineCapacity)};
+	byte_buffer::Buffer buffer(bytes);
+
+	// the appended bytes live in the storage the growth replaces
+	buffer.append(buffer.data());
+	buffer.append(buffer.data().subspan(10, 100));
+
+	std::vector expected(bytes);
+	expected.insert(expected.end(), bytes.begin(), bytes.end());
+	expected.insert(expected.end(), expected.begin() + 10, expected.begin() + 110);
+
+	ASSERT_TRUE(std::ranges::equal(buffer.data(), expected));
+}
+
+TEST(buffer_stress_unit_tests, overwrite_with_own_data)
+{
+	const auto bytes{pattern(1000)};
+	byte_buffer::Buffer buffer(bytes);
+
+	buffer.overwrite(buffer.data().subspan(1, 998));
+
+	ASSERT_TRUE(std::ranges::equal(buffer.data(), std::span(bytes).subspan(1, 998)));
+}
+
+TEST(buffer_stress_unit_tests, failed_growth_keeps_data)
+{
+	byte_buffer::fuzz::CheckedResource resource;
+	const auto bytes{pattern(1000)};
+	byte_buffer::Buffer buffer(bytes, &resource);
+	const auto capacity{buffer.capacity()};
+
+	ASSERT_THROW(buffer.reserve(byte_buffer::fuzz::CheckedResource::maxAllocationSize + 1), std::bad_alloc);
+	ASSERT_THROW(buffer.append(pattern(byte_buffer::fuzz::CheckedResource::maxAllocationSize)), std::bad_alloc);
+	ASSERT_THROW(buffer.overwrite(pattern(byte_buffer::fuzz::CheckedResource::maxAllocationSize + 1)), std::bad_alloc);
+	ASSERT_THROW(static_cast<void>(buffer.prepare(std::numeric_limits<byte_buffer::BufferSize>::max())), std::length_error);
+	ASSERT_EQ(buffer.capacity(), capacity);
+	ASSERT_TRUE(std::ranges::equal(buffer.data(), bytes));
+}
+
+int main(int argc, char** argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
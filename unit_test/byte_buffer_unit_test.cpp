@@ -1,10 +1,45 @@
 #include <cstring>
+#include <fcntl.h>
 #include <filesystem>
 #include <fstream>
 #include <gtest/gtest.h>
+#include <limits>
+#include <memory_resource>
+#include <stdexcept>
+#include <system_error>
+#include <unistd.h>
+#include <vector>
 
 #include "../include/byte_buffer/byte_buffer.hpp"
 
+namespace
+{
+class CountingResource final : public std::pmr::memory_resource
+{
+public:
+	int allocations{};
+	int deallocations{};
+
+private:
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		++allocations;
+		return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+	}
+
+	void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+	{
+		++deallocations;
+		std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+	{
+		return this == &other;
+	}
+};
+} // namespace
+
 TEST(byte_buffer_unit_tests, default_construct)
 {
 	const byte_buffer::Buffer buffer;
@@ -451,6 +486,507 @@ TEST(byte_buffer_unit_tests, clear)
 	ASSERT_TRUE(buffer.empty());
 }
 
+TEST(byte_buffer_unit_tests, append_with_geometric_growth)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}, std::byte{0x4}};
+	constexpr auto someDataSize{std::size(someData)};
+	constexpr auto appendCount{1000};
+
+	byte_buffer::Buffer buffer(byte_buffer::GrowthPolicy::geometric_2);
+	auto reallocationCount{0};
+
+	for (auto i{0}; i < appendCount; ++i)
+	{
+		const auto oldCapacity{buffer.capacity()};
+		buffer.append({someData, someDataSize});
+		reallocationCount += buffer.capacity() != oldCapacity;
+
+		ASSERT_EQ(std::memcmp(someData, buffer.data().data() + i * someDataSize, someDataSize), 0);
+	}
+
+	ASSERT_EQ(buffer.size(), appendCount * someDataSize);
+	ASSERT_GE(buffer.capacity(), buffer.size());
+	ASSERT_LE(buffer.capacity(), 2 * buffer.size());
+	ASSERT_LE(reallocationCount, 12);
+}
+
+TEST(byte_buffer_unit_tests, append_with_one_and_a_half_growth)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::Buffer buffer(byte_buffer::GrowthPolicy::geometric_1_5);
+	buffer.reserve(10);
+	buffer.overwrite({someData, someDataSize});
+
+	for (auto i{0}; i < 4; ++i)
+	{
+		buffer.append({someData, someDataSize});
+	}
+
+	ASSERT_EQ(buffer.capacity(), 10);
+
+	buffer.append({someData, someDataSize});
+
+	ASSERT_EQ(buffer.size(), 6 * someDataSize);
+	ASSERT_EQ(buffer.capacity(), 15);
+}
+
+TEST(byte_buffer_unit_tests, append_with_page_rounded_growth)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::Buffer buffer;
+	buffer.set_growth_policy(byte_buffer::GrowthPolicy::page_rounded);
+	buffer.append({someData, someDataSize});
+
+	ASSERT_EQ(buffer.growth_policy(), byte_buffer::GrowthPolicy::page_rounded);
+	ASSERT_EQ(buffer.size(), someDataSize);
+	ASSERT_EQ(buffer.capacity(), byte_buffer::Buffer::pageSize);
+	ASSERT_EQ(std::memcmp(someData, buffer.data().data(), someDataSize), 0);
+}
+
+TEST(byte_buffer_unit_tests, append_with_fixed_chunk_growth_from_file)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+	constexpr auto fileName{"test"};
+
+	{
+		std::ofstream file(fileName);
+		file.write(reinterpret_cast<const char*>(someData), someDataSize);
+	}
+
+	byte_buffer::Buffer buffer(byte_buffer::GrowthPolicy::fixed_chunk);
+
+	{
+		std::ifstream file(fileName);
+		buffer.append(file, someDataSize);
+	}
+
+	ASSERT_EQ(buffer.size(), someDataSize);
+	ASSERT_EQ(buffer.capacity(), byte_buffer::Buffer::chunkSize);
+	ASSERT_EQ(std::memcmp(someData, buffer.data().data(), someDataSize), 0);
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(byte_buffer_unit_tests, overwrite_ignores_growth_policy)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::Buffer buffer(byte_buffer::GrowthPolicy::geometric_2);
+	buffer.overwrite({someData, someDataSize});
+
+	const byte_buffer::Buffer bufferCopy(buffer);
+
+	ASSERT_EQ(buffer.capacity(), someDataSize);
+	ASSERT_EQ(bufferCopy.growth_policy(), byte_buffer::GrowthPolicy::geometric_2);
+}
+
+TEST(byte_buffer_unit_tests, allocate_from_memory_resource)
+{
+	const std::vector<std::byte> someData(2 * byte_buffer::Buffer::inlineCapacity, std::byte{0x1});
+	const auto someDataSize{someData.size()};
+
+	CountingResource resource;
+
+	{
+		byte_buffer::Buffer buffer({someData.data(), someDataSize}, &resource);
+		buffer.append({someData.data(), someDataSize});
+
+		ASSERT_EQ(buffer.resource(), &resource);
+		ASSERT_EQ(buffer.size(), 2 * someDataSize);
+		ASSERT_EQ(std::memcmp(someData.data(), buffer.data().data() + someDataSize, someDataSize), 0);
+		ASSERT_EQ(resource.allocations, 2);
+		ASSERT_EQ(resource.deallocations, 1);
+	}
+
+	ASSERT_EQ(resource.deallocations, 2);
+}
+
+TEST(byte_buffer_unit_tests, move_between_memory_resources)
+{
+	const std::vector<std::byte> someData(2 * byte_buffer::Buffer::inlineCapacity, std::byte{0x1});
+	const auto someDataSize{someData.size()};
+
+	CountingResource resourceOld;
+	CountingResource resourceNew;
+
+	byte_buffer::Buffer bufferOld({someData.data(), someDataSize}, &resourceOld);
+	byte_buffer::Buffer bufferMoved(std::move(bufferOld));
+
+	ASSERT_EQ(bufferMoved.resource(), &resourceOld);
+	ASSERT_EQ(resourceOld.allocations, 1);
+
+	byte_buffer::Buffer bufferNew(&resourceNew);
+	bufferNew = std::move(bufferMoved);
+
+	ASSERT_EQ(bufferNew.resource(), &resourceNew);
+	ASSERT_EQ(bufferNew.size(), someDataSize);
+	ASSERT_EQ(std::memcmp(someData.data(), bufferNew.data().data(), someDataSize), 0);
+	ASSERT_EQ(bufferMoved.data().data(), nullptr);
+	ASSERT_EQ(bufferMoved.capacity(), 0);
+	ASSERT_EQ(resourceOld.deallocations, 1);
+	ASSERT_EQ(resourceNew.allocations, 1);
+}
+
+TEST(byte_buffer_unit_tests, small_buffer_does_not_allocate)
+{
+	const std::vector<std::byte> someData(byte_buffer::Buffer::inlineCapacity, std::byte{0x1});
+	const auto someDataSize{someData.size()};
+
+	CountingResource resource;
+
+	{
+		byte_buffer::Buffer buffer(&resource);
+		buffer.append({someData.data(), someDataSize / 2});
+		buffer.append({someData.data(), someDataSize / 2});
+		buffer.reserve(byte_buffer::Buffer::inlineCapacity);
+
+		const byte_buffer::Buffer bufferCopy(buffer);
+
+		ASSERT_EQ(buffer.size(), someDataSize);
+		ASSERT_EQ(buffer.capacity(), byte_buffer::Buffer::inlineCapacity);
+		ASSERT_EQ(std::memcmp(someData.data(), buffer.data().data(), someDataSize), 0);
+		ASSERT_EQ(std::memcmp(someData.data(), bufferCopy.data().data(), someDataSize), 0);
+	}
+
+	ASSERT_EQ(resource.allocations, 0);
+}
+
+TEST(byte_buffer_unit_tests, small_buffer_switches_to_heap)
+{
+	std::vector<std::byte> someData(byte_buffer::Buffer::inlineCapacity + 1);
+
+	for (auto i{0u}; i < someData.size(); ++i)
+	{
+		someData[i] = std::byte(i);
+	}
+
+	CountingResource resource;
+
+	byte_buffer::Buffer buffer({someData.data(), byte_buffer::Buffer::inlineCapacity}, &resource);
+	const auto inlineData{buffer.data().data()};
+
+	ASSERT_EQ(resource.allocations, 0);
+
+	buffer.append({someData.data() + byte_buffer::Buffer::inlineCapacity, 1});
+
+	ASSERT_NE(buffer.data().data(), inlineData);
+	ASSERT_EQ(buffer.size(), someData.size());
+	ASSERT_EQ(std::memcmp(someData.data(), buffer.data().data(), someData.size()), 0);
+	ASSERT_EQ(resource.allocations, 1);
+}
+
+TEST(byte_buffer_unit_tests, move_small_buffer)
+{
+	constexpr std::byte expectedData[] = {std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto expectedDataSize{std::size(expectedData)};
+
+	byte_buffer::Buffer bufferOld({expectedData, expectedDataSize});
+	byte_buffer::Buffer bufferMoved(std::move(bufferOld));
+	byte_buffer::Buffer bufferNew;
+	bufferNew = std::move(bufferMoved);
+
+	ASSERT_EQ(bufferMoved.data().data(), nullptr);
+	ASSERT_EQ(bufferMoved.capacity(), 0);
+
+	bufferMoved.append({expectedData, expectedDataSize});
+
+	ASSERT_EQ(bufferNew.size(), expectedDataSize);
+	ASSERT_EQ(bufferNew.capacity(), expectedDataSize);
+	ASSERT_EQ(std::memcmp(expectedData, bufferNew.data().data(), expectedDataSize), 0);
+	ASSERT_NE(bufferNew.data().data(), bufferMoved.data().data());
+	ASSERT_EQ(std::memcmp(expectedData, bufferMoved.data().data(), expectedDataSize), 0);
+}
+
+TEST(byte_buffer_unit_tests, write_to_and_read_from_file_descriptor)
+{
+	constexpr std::byte expectedData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto expectedDataSize{std::size(expectedData)};
+	constexpr auto fileName{"test"};
+
+	{
+		const byte_buffer::Buffer buffer({expectedData, expectedDataSize});
+		const auto fd{::open(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644)};
+		buffer.write_to(fd);
+		::close(fd);
+	}
+
+	byte_buffer::Buffer buffer({expectedData, 1});
+	const auto fd{::open(fileName, O_RDONLY)};
+
+	ASSERT_EQ(buffer.read_from(fd, 2 * expectedDataSize), expectedDataSize);
+
+	::close(fd);
+
+	ASSERT_EQ(buffer.size(), expectedDataSize + 1);
+	ASSERT_EQ(std::memcmp(expectedData, buffer.data().data() + 1, expectedDataSize), 0);
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(byte_buffer_unit_tests, positioned_write_to_and_read_from_file_descriptor)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+	constexpr auto fileName{"test"};
+
+	const auto fd{::open(fileName, O_RDWR | O_CREAT | O_TRUNC, 0644)};
+	const byte_buffer::Buffer bufferOut({someData, someDataSize});
+	bufferOut.write_to(fd, 10);
+
+	byte_buffer::Buffer buffer;
+
+	ASSERT_EQ(buffer.read_from(fd, 2, 11), 2);
+	ASSERT_EQ(::lseek(fd, 0, SEEK_CUR), 0);
+
+	::close(fd);
+
+	ASSERT_EQ(buffer.size(), 2);
+	ASSERT_EQ(std::memcmp(someData + 1, buffer.data().data(), 2), 0);
+	ASSERT_THROW(buffer.read_from(fd, 1), std::system_error);
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(byte_buffer_unit_tests, vectored_write_to_and_read_from_file_descriptor)
+{
+	const std::vector<std::byte> headerData(10, std::byte{0x1});
+	const std::vector<std::byte> bodyData(200, std::byte{0x2});
+	constexpr auto fileName{"test"};
+
+	{
+		const byte_buffer::Buffer header({headerData.data(), headerData.size()});
+		const byte_buffer::Buffer body({bodyData.data(), bodyData.size()});
+		const byte_buffer::Buffer* buffers[]{&header, &body};
+		const auto fd{::open(fileName, O_WRONLY | O_CREAT | O_TRUNC, 0644)};
+		byte_buffer::Buffer::write_to(fd, buffers);
+		::close(fd);
+	}
+
+	byte_buffer::Buffer header;
+	byte_buffer::Buffer body;
+	header.reserve(headerData.size());
+	body.reserve(2 * bodyData.size());
+	byte_buffer::Buffer* buffers[]{&header, &body};
+	const auto fd{::open(fileName, O_RDONLY)};
+
+	ASSERT_EQ(byte_buffer::Buffer::read_from(fd, buffers), headerData.size() + bodyData.size());
+
+	::close(fd);
+
+	ASSERT_EQ(header.size(), headerData.size());
+	ASSERT_EQ(body.size(), bodyData.size());
+	ASSERT_EQ(std::memcmp(headerData.data(), header.data().data(), headerData.size()), 0);
+	ASSERT_EQ(std::memcmp(bodyData.data(), body.data().data(), bodyData.size()), 0);
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(byte_buffer_unit_tests, read_batch)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}, std::byte{0x4}};
+	constexpr auto someDataSize{std::size(someData)};
+	constexpr auto fileName{"test"};
+
+	{
+		std::ofstream file(fileName);
+		file.write(reinterpret_cast<const char*>(someData), someDataSize);
+	}
+
+	byte_buffer::Buffer first;
+	byte_buffer::Buffer second;
+	const auto fd{::open(fileName, O_RDONLY)};
+	byte_buffer::ReadRequest requests[]{{&first, fd, 0, 2}, {&second, fd, 1, 10}};
+
+	byte_buffer::Buffer::read_batch(requests);
+
+	::close(fd);
+
+	ASSERT_EQ(requests[0].bytesRead, 2);
+	ASSERT_EQ(requests[1].bytesRead, 3);
+	ASSERT_EQ(first.size(), 2);
+	ASSERT_EQ(second.size(), 3);
+	ASSERT_EQ(std::memcmp(someData, first.data().data(), 2), 0);
+	ASSERT_EQ(std::memcmp(someData + 1, second.data().data(), 3), 0);
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(byte_buffer_unit_tests, size_overflow)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::Buffer buffer(byte_buffer::GrowthPolicy::geometric_2);
+	buffer.append({someData, someDataSize});
+
+	// the size check happens before the bytes are touched
+	const std::span<const std::byte> hugeBytes(someData, std::numeric_limits<std::size_t>::max() - 1);
+
+	ASSERT_THROW(buffer.append(hugeBytes), std::length_error);
+	ASSERT_EQ(buffer.size(), someDataSize);
+	ASSERT_EQ(std::memcmp(someData, buffer.data().data(), someDataSize), 0);
+}
+
+TEST(byte_buffer_unit_tests, resize_uninitialized)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+	constexpr auto newSize{2 * byte_buffer::Buffer::inlineCapacity};
+
+	byte_buffer::Buffer buffer({someData, someDataSize});
+	buffer.resize_uninitialized(newSize);
+
+	ASSERT_EQ(buffer.size(), newSize);
+	ASSERT_EQ(buffer.capacity(), newSize);
+	ASSERT_EQ(std::memcmp(someData, buffer.data().data(), someDataSize), 0);
+
+	buffer.resize_uninitialized(1);
+
+	ASSERT_EQ(buffer.size(), 1);
+	ASSERT_EQ(buffer.capacity(), newSize);
+	ASSERT_EQ(buffer.data()[0], someData[0]);
+}
+
+TEST(byte_buffer_unit_tests, prepare_and_commit)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::Buffer buffer({someData, someDataSize});
+	const auto window{buffer.prepare(2 * byte_buffer::Buffer::inlineCapacity)};
+
+	ASSERT_EQ(window.size(), 2 * byte_buffer::Buffer::inlineCapacity);
+	ASSERT_EQ(buffer.size(), someDataSize);
+	ASSERT_EQ(window.data(), buffer.data().data() + someDataSize);
+
+	std::memcpy(window.data(), someData, someDataSize);
+	buffer.commit(someDataSize);
+
+	ASSERT_EQ(buffer.size(), 2 * someDataSize);
+	ASSERT_EQ(std::memcmp(someData, buffer.data().data(), someDataSize), 0);
+	ASSERT_EQ(std::memcmp(someData, buffer.data().data() + someDataSize, someDataSize), 0);
+}
+
+TEST(byte_buffer_unit_tests, commit_beyond_capacity)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::Buffer buffer({someData, someDataSize});
+	buffer.reserve(someDataSize + 1);
+
+	ASSERT_THROW(buffer.commit(2), std::out_of_range);
+
+	buffer.commit(1);
+
+	ASSERT_EQ(buffer.size(), someDataSize + 1);
+}
+
+TEST(byte_buffer_unit_tests, set_alignment)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::Buffer buffer({someData, someDataSize});
+
+	ASSERT_EQ(buffer.alignment(), byte_buffer::Buffer::defaultAlignment);
+	ASSERT_THROW(buffer.set_alignment(48), std::invalid_argument);
+
+	for (const std::size_t alignment : {std::size_t{64}, std::size_t{4096}, std::size_t{2 << 20}})
+	{
+		buffer.set_alignment(alignment);
+
+		ASSERT_EQ(buffer.alignment(), alignment);
+		ASSERT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data().data()) % alignment, 0);
+		ASSERT_EQ(buffer.size(), someDataSize);
+		ASSERT_EQ(std::memcmp(someData, buffer.data().data(), someDataSize), 0);
+	}
+
+	buffer.append({someData, someDataSize});
+	buffer.reserve(1 << 20);
+
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data().data()) % (2 << 20), 0);
+
+	const auto copy{buffer};
+	const auto moved{std::move(buffer)};
+
+	ASSERT_EQ(copy.alignment(), 2 << 20);
+	ASSERT_EQ(moved.alignment(), 2 << 20);
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(copy.data().data()) % (2 << 20), 0);
+	ASSERT_EQ(std::memcmp(moved.data().data() + someDataSize, someData, someDataSize), 0);
+}
+
+TEST(byte_buffer_unit_tests, shrink_to_fit)
+{
+	const std::vector<std::byte> someData(1000, std::byte{0x1});
+
+	byte_buffer::Buffer buffer(someData);
+	buffer.reserve(1 << 20);
+	buffer.shrink_to_fit();
+
+	ASSERT_EQ(buffer.capacity(), someData.size());
+	ASSERT_EQ(std::memcmp(someData.data(), buffer.data().data(), someData.size()), 0);
+
+	buffer.resize_uninitialized(10);
+	buffer.shrink_to_fit();
+
+	ASSERT_EQ(buffer.capacity(), 10);
+	ASSERT_EQ(std::memcmp(someData.data(), buffer.data().data(), 10), 0);
+}
+
+TEST(byte_buffer_unit_tests, release)
+{
+	const std::vector<std::byte> someData(1000, std::byte{0x1});
+
+	for (const auto size : {std::size_t{0}, std::size_t{10}, someData.size()})
+	{
+		byte_buffer::Buffer buffer({someData.data(), size});
+		const auto storage{buffer.release()};
+
+		ASSERT_TRUE(buffer.empty());
+		ASSERT_EQ(buffer.capacity(), 0);
+		ASSERT_EQ(storage.size, size);
+		ASSERT_GE(storage.capacity, size);
+
+		if (storage.data)
+		{
+			ASSERT_EQ(std::memcmp(someData.data(), storage.data, size), 0);
+			storage.resource->deallocate(storage.data, storage.capacity, storage.alignment);
+		}
+	}
+}
+
+TEST(byte_buffer_unit_tests, trim_policy)
+{
+	const std::vector<std::byte> someData(1 << 20, std::byte{0x1});
+
+	byte_buffer::Buffer buffer;
+	buffer.set_trim_policy({.utilizationPercent = 10, .clears = 3});
+	buffer.append(someData);
+	buffer.clear();
+
+	// a well utilized clear restarts the count
+	for (const auto size : {std::size_t{1000}, std::size_t{1000}, someData.size() / 2, std::size_t{1000}, std::size_t{1000}})
+	{
+		buffer.append({someData.data(), size});
+		buffer.clear();
+
+		ASSERT_EQ(buffer.capacity(), someData.size());
+	}
+
+	buffer.append({someData.data(), 1000});
+	buffer.clear();
+
+	ASSERT_EQ(buffer.capacity(), 0);
+	ASSERT_EQ(buffer.trim_policy().clears, 3);
+}
+
 int main(int argc, char** argv)
 {
 	testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,226 @@
+#include <cstring>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../include/byte_buffer/byte_queue.hpp"
+
+namespace
+{
+struct Message
+{
+	uint32_t producer;
+	uint32_t sequence;
+};
+
+std::span<const std::byte> asBytes(const Message& message)
+{
+	return std::as_bytes(std::span{&message, 1});
+}
+
+// sizes vary with the sequence, so the records wrap around the ring at different offsets
+std::vector<std::byte> makePayload(uint32_t sequence)
+{
+	std::vector<std::byte> payload(sizeof(uint32_t) + sequence % 37);
+	std::memcpy(payload.data(), &sequence, sizeof(sequence));
+	return payload;
+}
+} // namespace
+
+template <typename Queue>
+class byte_queue_unit_tests : public testing::Test
+{
+};
+
+using Queues = testing::Types<byte_buffer::SpscByteQueue, byte_buffer::MpscByteQueue>;
+TYPED_TEST_SUITE(byte_queue_unit_tests, Queues);
+
+TYPED_TEST(byte_queue_unit_tests, push_and_pop)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	TypeParam queue(4096);
+	byte_buffer::Buffer message;
+
+	ASSERT_TRUE(queue.empty());
+	ASSERT_FALSE(queue.try_pop(message));
+	ASSERT_TRUE(queue.try_push({someData, someDataSize}));
+	ASSERT_TRUE(queue.try_push(std::span<const std::byte>{}));
+	ASSERT_FALSE(queue.empty());
+	ASSERT_TRUE(queue.try_pop(message));
+	ASSERT_EQ(message.size(), someDataSize);
+	ASSERT_EQ(std::memcmp(someData, message.data().data(), someDataSize), 0);
+	ASSERT_TRUE(queue.try_pop(message));
+	ASSERT_TRUE(message.empty());
+	ASSERT_TRUE(queue.empty());
+}
+
+TYPED_TEST(byte_queue_unit_tests, batched_push_and_consume)
+{
+	TypeParam queue(4096);
+	std::vector<std::vector<std::byte>> payloads;
+	std::vector<std::span<const std::byte>> messages;
+
+	for (uint32_t i{}; i < 10; ++i)
+	{
+		payloads.push_back(makePayload(i));
+	}
+
+	for (const auto& payload : payloads)
+	{
+		messages.emplace_back(payload);
+	}
+
+	ASSERT_EQ(queue.try_push_batch(messages), messages.size());
+
+	uint32_t expected{};
+
+	ASSERT_EQ(queue.consume([&](std::span<const std::byte> message) {
+		ASSERT_EQ(message.size(), payloads[expected].size());
+		ASSERT_EQ(std::memcmp(payloads[expected].data(), message.data(), message.size()), 0);
+		++expected;
+	}, 4), 4);
+	ASSERT_EQ(queue.consume([&](std::span<const std::byte>) { ++expected; }), 6);
+	ASSERT_EQ(expected, 10);
+	ASSERT_TRUE(queue.empty());
+}
+
+TYPED_TEST(byte_queue_unit_tests, full_queue)
+{
+	TypeParam queue(4096);
+	const std::vector<std::byte> payload(1000, std::byte{0x1});
+	const std::vector<std::byte> hugePayload(queue.capacity(), std::byte{0x1});
+	auto pushed{0};
+
+	while (queue.try_push(payload))
+	{
+		++pushed;
+	}
+
+	ASSERT_EQ(pushed, queue.capacity() / byte_buffer::detail::recordSize(payload.size()));
+	ASSERT_THROW(queue.try_push(hugePayload), std::length_error);
+
+	byte_buffer::Buffer message;
+
+	ASSERT_TRUE(queue.try_pop(message));
+	ASSERT_TRUE(queue.try_push(payload));
+}
+
+TYPED_TEST(byte_queue_unit_tests, wrap_around)
+{
+	TypeParam queue(4096);
+	byte_buffer::Buffer message;
+
+	for (uint32_t i{}; i < 10000; ++i)
+	{
+		const auto payload{makePayload(i)};
+
+		ASSERT_TRUE(queue.try_push(payload));
+		ASSERT_TRUE(queue.try_pop(message));
+		ASSERT_EQ(message.size(), payload.size());
+		ASSERT_EQ(std::memcmp(payload.data(), message.data().data(), payload.size()), 0);
+	}
+}
+
+TEST(spsc_byte_queue_unit_tests, concurrent_producer_and_consumer)
+{
+	constexpr uint32_t messageCount{50000};
+
+	byte_buffer::SpscByteQueue queue(4096);
+
+	std::thread producer([&queue] {
+		for (uint32_t i{}; i < messageCount;)
+		{
+			if (queue.try_push(asBytes({0, i})))
+			{
+				++i;
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	});
+
+	uint32_t expected{};
+
+	while (expected < messageCount)
+	{
+		const auto consumed{queue.consume([&expected](std::span<const std::byte> bytes) {
+			Message message;
+			std::memcpy(&message, bytes.data(), sizeof(message));
+			EXPECT_EQ(message.sequence, expected);
+			++expected;
+		})};
+
+		if (!consumed)
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	producer.join();
+
+	ASSERT_TRUE(queue.empty());
+}
+
+TEST(mpsc_byte_queue_unit_tests, concurrent_producers_and_consumer)
+{
+	constexpr uint32_t producerCount{4};
+	constexpr uint32_t messageCount{10000};
+
+	byte_buffer::MpscByteQueue queue(4096);
+	std::vector<std::thread> producers;
+
+	for (uint32_t producer{}; producer < producerCount; ++producer)
+	{
+		producers.emplace_back([&queue, producer] {
+			for (uint32_t i{}; i < messageCount;)
+			{
+				if (queue.try_push(asBytes({producer, i})))
+				{
+					++i;
+				}
+				else
+				{
+					std::this_thread::yield();
+				}
+			}
+		});
+	}
+
+	std::vector<uint32_t> expected(producerCount);
+	uint32_t consumed{};
+
+	while (consumed < producerCount * messageCount)
+	{
+		const auto count{queue.consume([&expected](std::span<const std::byte> bytes) {
+			Message message;
+			ASSERT_EQ(bytes.size(), sizeof(message));
+			std::memcpy(&message, bytes.data(), sizeof(message));
+			EXPECT_EQ(message.sequence, expected[message.producer]++);
+		})};
+
+		if (!count)
+		{
+			std::this_thread::yield();
+		}
+
+		consumed += count;
+	}
+
+	for (auto& producer : producers)
+	{
+		producer.join();
+	}
+
+	ASSERT_TRUE(queue.empty());
+}
+
+int main(int argc, char** argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
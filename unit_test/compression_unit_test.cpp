@@ -0,0 +1,190 @@
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/byte_buffer/compression.hpp"
+
+namespace
+{
+std::vector<std::byte> compressibleData(std::size_t size)
+{
+	std::vector<std::byte> data(size);
+
+	for (std::size_t i{}; i < size; ++i)
+	{
+		data[i] = static_cast<std::byte>((i / 7) % 31);
+	}
+
+	return data;
+}
+
+class compression_unit_tests : public ::testing::TestWithParam<byte_buffer::Codec>
+{
+protected:
+	void SetUp() override
+	{
+		if (!byte_buffer::codec_available(GetParam()))
+		{
+			GTEST_SKIP() << "codec is not enabled";
+		}
+	}
+};
+} // namespace
+
+TEST_P(compression_unit_tests, round_trip)
+{
+	const auto someData{compressibleData(1 << 20)};
+
+	byte_buffer::Buffer compressed;
+	byte_buffer::compress(GetParam(), someData, compressed);
+
+	ASSERT_LT(compressed.size(), someData.size());
+
+	byte_buffer::Buffer decompressed;
+	byte_buffer::decompress(GetParam(), compressed.data(), decompressed);
+
+	ASSERT_EQ(decompressed.size(), someData.size());
+	ASSERT_TRUE(std::equal(someData.begin(), someData.end(), decompressed.data().begin()));
+}
+
+TEST_P(compression_unit_tests, appends_to_existing_data)
+{
+	const std::vector<std::byte> prefix(10, std::byte{0x7});
+	const auto someData{compressibleData(5000)};
+
+	byte_buffer::Buffer compressed(prefix);
+	byte_buffer::compress(GetParam(), someData, compressed);
+
+	byte_buffer::Buffer decompressed(prefix);
+	byte_buffer::decompress(GetParam(), compressed.data().subspan(prefix.size()), decompressed, someData.size());
+
+	ASSERT_EQ(decompressed.size(), prefix.size() + someData.size());
+	ASSERT_EQ(decompressed.capacity(), decompressed.size());
+	ASSERT_TRUE(std::equal(someData.begin(), someData.end(), decompressed.data().begin() + prefix.size()));
+}
+
+TEST_P(compression_unit_tests, streaming_round_trip)
+{
+	const auto someData{compressibleData(3 << 20)};
+	const std::span<const std::byte> bytes(someData);
+	constexpr std::size_t chunkSize{100000};
+
+	byte_buffer::Buffer compressed;
+	byte_buffer::CompressionStream compressor(GetParam(), compressed);
+
+	for (std::size_t offset{}; offset < bytes.size(); offset += chunkSize)
+	{
+		compressor.write(bytes.subspan(offset, std::min(chunkSize, bytes.size() - offset)));
+	}
+
+	compressor.finish();
+
+	// the frame has no content size, so the output grows while decompressing
+	byte_buffer::Buffer decompressed;
+	byte_buffer::DecompressionStream decompressor(GetParam(), decompressed);
+	const auto compressedBytes{compressed.data()};
+
+	for (std::size_t offset{}; offset < compressedBytes.size(); offset += 1000)
+	{
+		decompressor.write(compressedBytes.subspan(offset, std::min<std::size_t>(1000, compressedBytes.size() - offset)));
+	}
+
+	ASSERT_TRUE(decompressor.finished());
+	ASSERT_EQ(decompressed.size(), someData.size());
+	ASSERT_TRUE(std::equal(someData.begin(), someData.end(), decompressed.data().begin()));
+
+	byte_buffer::Buffer oneShot;
+	byte_buffer::decompress(GetParam(), compressed.data(), oneShot);
+
+	ASSERT_EQ(oneShot.size(), someData.size());
+}
+
+TEST_P(compression_unit_tests, truncated_data)
+{
+	const auto someData{compressibleData(5000)};
+
+	byte_buffer::Buffer compressed;
+	byte_buffer::compress(GetParam(), someData, compressed);
+
+	// a failed decompression keeps the previous data only
+	const std::vector<std::byte> prefix(10, std::byte{0x7});
+	byte_buffer::Buffer decompressed(prefix);
+
+	ASSERT_THROW(byte_buffer::decompress(GetParam(), compressed.data().first(compressed.size() - 1), decompressed), std::runtime_error);
+	ASSERT_EQ(decompressed.size(), prefix.size());
+	ASSERT_THROW(byte_buffer::decompress(GetParam(), compressed.data(), decompressed, 100), std::runtime_error);
+	ASSERT_EQ(decompressed.size(), prefix.size());
+	ASSERT_TRUE(std::equal(prefix.begin(), prefix.end(), decompressed.data().begin()));
+}
+
+TEST_P(compression_unit_tests, size_exceeds_maximum)
+{
+	byte_buffer::Buffer compressed;
+	byte_buffer::compress(GetParam(), compressibleData(100), compressed);
+
+	byte_buffer::Buffer decompressed(compressed);
+
+	ASSERT_THROW(byte_buffer::decompress(GetParam(), compressed.data(), decompressed, std::numeric_limits<byte_buffer::BufferSize>::max()),
+		std::length_error);
+	ASSERT_EQ(decompressed.size(), compressed.size());
+}
+
+TEST_P(compression_unit_tests, untrusted_content_size)
+{
+	constexpr uint64_t hostileSize{uint64_t{1} << 40};
+	std::vector<std::byte> frame;
+
+	if (GetParam() == byte_buffer::Codec::lz4)
+	{
+		// the content size of a real frame is replaced, which also breaks the header checksum
+		byte_buffer::Buffer compressed;
+		byte_buffer::compress(GetParam(), compressibleData(1000), compressed);
+		frame.assign(compressed.data().begin(), compressed.data().end());
+
+		for (std::size_t i{}; i < sizeof(hostileSize); ++i)
+		{
+			frame[6 + i] = static_cast<std::byte>(hostileSize >> (8 * i));
+		}
+	}
+	else
+	{
+		// single segment frame with an 8-byte content size and a single empty raw block
+		frame = {std::byte{0x28}, std::byte{0xb5}, std::byte{0x2f}, std::byte{0xfd}, std::byte{0xe0}};
+
+		for (std::size_t i{}; i < sizeof(hostileSize); ++i)
+		{
+			frame.push_back(static_cast<std::byte>(hostileSize >> (8 * i)));
+		}
+
+		frame.insert(frame.end(), {std::byte{0x01}, std::byte{0x00}, std::byte{0x00}});
+	}
+
+	byte_buffer::Buffer decompressed;
+
+	ASSERT_THROW(byte_buffer::decompress(GetParam(), frame, decompressed), std::runtime_error);
+	ASSERT_LT(decompressed.capacity(), 1 << 20);
+}
+
+INSTANTIATE_TEST_SUITE_P(codecs, compression_unit_tests, ::testing::Values(byte_buffer::Codec::lz4, byte_buffer::Codec::zstd));
+
+TEST(compression_availability_unit_tests, disabled_codec_throws)
+{
+	for (const auto codec : {byte_buffer::Codec::lz4, byte_buffer::Codec::zstd})
+	{
+		if (!byte_buffer::codec_available(codec))
+		{
+			byte_buffer::Buffer buffer;
+			ASSERT_THROW(byte_buffer::compress(codec, {}, buffer), std::invalid_argument);
+			ASSERT_THROW(byte_buffer::CompressionStream(codec, buffer), std::invalid_argument);
+		}
+	}
+}
+
+int main(int argc, char** argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
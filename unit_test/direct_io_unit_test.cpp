@@ -0,0 +1,127 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <system_error>
+#include <vector>
+
+#include "../include/byte_buffer/direct_io.hpp"
+
+namespace
+{
+constexpr auto fileName{"direct_io_test"};
+
+std::vector<std::byte> testData(std::size_t size)
+{
+	std::vector<std::byte> data(size);
+
+	for (auto i{0u}; i < size; ++i)
+	{
+		data[i] = std::byte(i * 7);
+	}
+
+	return data;
+}
+
+std::vector<std::byte> readTestFile()
+{
+	std::ifstream file(fileName, std::ios::binary);
+	std::vector<std::byte> data(std::filesystem::file_size(fileName));
+	file.read(reinterpret_cast<char*>(data.data()), data.size());
+
+	return data;
+}
+} // namespace
+
+TEST(direct_io_unit_tests, write_with_unaligned_tail)
+{
+	const auto someData{testData(3 * byte_buffer::DirectReader::blockSize + 123)};
+
+	{
+		byte_buffer::DirectWriter writer(fileName, 2 * byte_buffer::DirectReader::blockSize);
+
+		// odd sized writes cross chunk boundaries
+		for (std::size_t offset{}; offset < someData.size(); offset += 1000)
+		{
+			writer.write(std::span(someData).subspan(offset, std::min<std::size_t>(1000, someData.size() - offset)));
+		}
+
+		writer.close();
+	}
+
+	ASSERT_EQ(readTestFile(), someData);
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(direct_io_unit_tests, read_chunks)
+{
+	const auto someData{testData(5 * byte_buffer::DirectReader::blockSize + 17)};
+
+	{
+		byte_buffer::DirectWriter writer(fileName);
+		writer.write(someData);
+	}
+
+	byte_buffer::DirectReader reader(fileName, 0, 2 * byte_buffer::DirectReader::blockSize);
+	std::vector<std::byte> readData;
+
+	for (auto chunk{reader.next()}; !chunk.empty(); chunk = reader.next())
+	{
+		ASSERT_EQ(reinterpret_cast<std::uintptr_t>(chunk.data()) % byte_buffer::DirectReader::blockSize, 0);
+		readData.insert(readData.end(), chunk.begin(), chunk.end());
+	}
+
+	ASSERT_EQ(readData, someData);
+	ASSERT_TRUE(reader.next().empty());
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(direct_io_unit_tests, append_from_unaligned_offset)
+{
+	const auto someData{testData(100000)};
+	constexpr std::size_t offset{5000};
+
+	{
+		byte_buffer::DirectWriter writer(fileName);
+		writer.write(someData);
+	}
+
+	byte_buffer::Buffer buffer;
+	byte_buffer::DirectReader reader(fileName, offset, byte_buffer::DirectReader::blockSize);
+	reader.append_to(buffer);
+
+	ASSERT_EQ(buffer.size(), someData.size() - offset);
+	ASSERT_EQ(buffer.capacity(), buffer.size());
+	ASSERT_EQ(std::memcmp(someData.data() + offset, buffer.data().data(), buffer.size()), 0);
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(direct_io_unit_tests, empty_file)
+{
+	{
+		byte_buffer::DirectWriter writer(fileName);
+	}
+
+	ASSERT_EQ(std::filesystem::file_size(fileName), 0);
+
+	byte_buffer::DirectReader reader(fileName);
+
+	ASSERT_TRUE(reader.next().empty());
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(direct_io_unit_tests, open_missing_file)
+{
+	ASSERT_THROW(byte_buffer::DirectReader("missing/file"), std::system_error);
+	ASSERT_THROW(byte_buffer::DirectWriter("missing/file"), std::system_error);
+}
+
+int main(int argc, char** argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
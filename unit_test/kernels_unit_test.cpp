@@ -0,0 +1,171 @@
+#include <algorithm>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <random>
+#include <string_view>
+#include <vector>
+
+#include "../include/byte_buffer/kernels.hpp"
+
+namespace
+{
+std::vector<std::byte> randomBytes(std::size_t size, unsigned seed, int alphabetSize = 256)
+{
+	std::mt19937 generator(seed);
+	std::uniform_int_distribution<int> distribution(0, alphabetSize - 1);
+	std::vector<std::byte> bytes(size);
+
+	for (auto& byte : bytes)
+	{
+		byte = std::byte(distribution(generator));
+	}
+
+	return bytes;
+}
+
+std::span<const std::byte> asBytes(std::string_view string)
+{
+	return std::as_bytes(std::span{string});
+}
+} // namespace
+
+TEST(kernels_unit_tests, find_byte_agrees_with_scalar)
+{
+	for (auto size{0u}; size < 200; ++size)
+	{
+		const auto data{randomBytes(size, size, 64)};
+
+		for (auto value{0}; value < 70; ++value)
+		{
+			ASSERT_EQ(byte_buffer::kernels::find(data, std::byte(value)), byte_buffer::kernels::scalar::find(data, std::byte(value)));
+		}
+	}
+}
+
+TEST(kernels_unit_tests, find_pattern_agrees_with_scalar)
+{
+	for (auto size{0u}; size < 200; size += 3)
+	{
+		const auto data{randomBytes(size, size, 4)};
+
+		for (auto patternSize{0u}; patternSize < 8; ++patternSize)
+		{
+			const auto pattern{randomBytes(patternSize, size + patternSize, 4)};
+
+			ASSERT_EQ(byte_buffer::kernels::find(data, pattern), byte_buffer::kernels::scalar::find(data, pattern));
+		}
+	}
+}
+
+TEST(kernels_unit_tests, find_pattern)
+{
+	const auto data{asBytes("the quick brown fox jumps over the lazy dog, the quick brown fox")};
+
+	ASSERT_EQ(byte_buffer::kernels::find(data, asBytes("lazy")), 35);
+	ASSERT_EQ(byte_buffer::kernels::find(data, asBytes("quick brown fox")), 4);
+	ASSERT_EQ(byte_buffer::kernels::find(data, asBytes("cat")), byte_buffer::kernels::npos);
+	ASSERT_EQ(byte_buffer::kernels::find(data, asBytes("")), 0);
+	ASSERT_EQ(byte_buffer::kernels::find(data, std::byte{'q'}), 4);
+}
+
+TEST(kernels_unit_tests, equal_agrees_with_scalar)
+{
+	for (auto size{0u}; size < 200; ++size)
+	{
+		const auto lhs{randomBytes(size, size)};
+		auto rhs{lhs};
+
+		ASSERT_TRUE(byte_buffer::kernels::equal(lhs, rhs));
+
+		if (size)
+		{
+			rhs[size / 2] ^= std::byte{0x1};
+
+			ASSERT_FALSE(byte_buffer::kernels::equal(lhs, rhs));
+			ASSERT_FALSE(byte_buffer::kernels::equal(lhs, std::span{rhs}.first(size - 1)));
+		}
+	}
+}
+
+TEST(kernels_unit_tests, crc32c)
+{
+	ASSERT_EQ(byte_buffer::kernels::crc32c(asBytes("123456789")), 0xe3069283u);
+	ASSERT_EQ(byte_buffer::kernels::crc32c(asBytes("")), 0u);
+
+	for (auto size{0u}; size < 200; ++size)
+	{
+		const auto data{randomBytes(size, size)};
+		const auto crc{byte_buffer::kernels::crc32c(data)};
+
+		ASSERT_EQ(crc, byte_buffer::kernels::scalar::crc32c(data));
+		ASSERT_EQ(crc, byte_buffer::kernels::crc32c(std::span{data}.subspan(size / 3), byte_buffer::kernels::crc32c(std::span{data}.first(size / 3))));
+	}
+}
+
+TEST(kernels_unit_tests, crc32c_combine)
+{
+	const auto data{randomBytes(10000, 11)};
+	const std::span<const std::byte> bytes(data);
+
+	for (const auto split : {0u, 1u, 8u, 4999u, 10000u})
+	{
+		const auto crc{byte_buffer::kernels::crc32c(bytes.first(split), 0x12345678)};
+		const auto nextCrc{byte_buffer::kernels::crc32c(bytes.subspan(split))};
+
+		ASSERT_EQ(byte_buffer::kernels::crc32c_combine(crc, nextCrc, bytes.size() - split), byte_buffer::kernels::crc32c(bytes, 0x12345678));
+	}
+}
+
+TEST(kernels_unit_tests, crc32c_combine_huge_sizes)
+{
+	// combining over a + b bytes equals combining over a bytes of zero checksum and then over b bytes
+	for (const auto size : {std::size_t{1} << 61, (std::size_t{1} << 62) + 5, ~std::size_t{} / 2})
+	{
+		const auto crc{byte_buffer::kernels::crc32c_combine(0x12345678, 0, size)};
+
+		ASSERT_EQ(byte_buffer::kernels::crc32c_combine(crc, 0x9abcdef0, size), byte_buffer::kernels::crc32c_combine(0x12345678, 0x9abcdef0, 2 * size));
+	}
+}
+
+TEST(kernels_unit_tests, non_temporal_stores)
+{
+	const auto data{randomBytes(1000, 12)};
+
+	// the destination offsets cover unaligned heads, streamed blocks and tails
+	for (auto offset{0u}; offset < 16; ++offset)
+	{
+		for (const auto size : {0u, 15u, 16u, 100u, 1000u})
+		{
+			std::vector<std::byte> destination(offset + 1001, std::byte{0xee});
+			byte_buffer::kernels::copy_non_temporal(std::span(destination).subspan(offset), std::span(data).first(size));
+
+			ASSERT_EQ(std::memcmp(destination.data() + offset, data.data(), size), 0);
+			ASSERT_EQ(destination[offset + size], std::byte{0xee});
+
+			byte_buffer::kernels::fill_non_temporal(std::span(destination).subspan(offset, size), std::byte{0x3});
+
+			ASSERT_EQ(std::count(destination.begin() + offset, destination.begin() + offset + size, std::byte{0x3}), size);
+			ASSERT_EQ(destination[offset + size], std::byte{0xee});
+		}
+	}
+}
+
+TEST(kernels_unit_tests, hash64)
+{
+	ASSERT_EQ(byte_buffer::kernels::hash64(asBytes("")), 0xef46db3751d8e999ull);
+	ASSERT_EQ(byte_buffer::kernels::hash64(asBytes("a")), 0xd24ec4f1a98c6e5bull);
+
+	const auto data{randomBytes(100, 1)};
+	auto changedData{data};
+	changedData[99] ^= std::byte{0x1};
+
+	ASSERT_EQ(byte_buffer::kernels::hash64(data), byte_buffer::kernels::hash64(data));
+	ASSERT_NE(byte_buffer::kernels::hash64(data), byte_buffer::kernels::hash64(changedData));
+	ASSERT_NE(byte_buffer::kernels::hash64(data), byte_buffer::kernels::hash64(data, 1));
+}
+
+int main(int argc, char** argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
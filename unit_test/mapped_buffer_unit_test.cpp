@@ -0,0 +1,105 @@
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+#include "../include/byte_buffer/mapped_buffer.hpp"
+
+namespace
+{
+constexpr auto fileName{"test"};
+
+std::vector<std::byte> writeTestFile(std::size_t size)
+{
+	std::vector<std::byte> data(size);
+
+	for (auto i{0u}; i < size; ++i)
+	{
+		data[i] = std::byte(i * 7);
+	}
+
+	std::ofstream file(fileName);
+	file.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+	return data;
+}
+} // namespace
+
+TEST(mapped_buffer_unit_tests, default_construct)
+{
+	const byte_buffer::MappedBuffer buffer;
+
+	ASSERT_EQ(buffer.data().data(), nullptr);
+	ASSERT_EQ(buffer.size(), 0);
+	ASSERT_TRUE(buffer.empty());
+}
+
+TEST(mapped_buffer_unit_tests, map_whole_file)
+{
+	const auto expectedData{writeTestFile(10000)};
+
+	const byte_buffer::MappedBuffer buffer(fileName);
+	buffer.advise(byte_buffer::AccessHint::sequential);
+	buffer.advise(byte_buffer::AccessHint::willneed);
+
+	ASSERT_EQ(buffer.size(), expectedData.size());
+	ASSERT_EQ(std::memcmp(expectedData.data(), buffer.data().data(), expectedData.size()), 0);
+	ASSERT_FALSE(buffer.empty());
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(mapped_buffer_unit_tests, map_unaligned_region)
+{
+	constexpr auto offset{5000};
+	constexpr auto length{3000};
+	const auto fileData{writeTestFile(10000)};
+
+	const byte_buffer::MappedBuffer buffer(fileName, offset, length);
+
+	ASSERT_EQ(buffer.size(), length);
+	ASSERT_EQ(std::memcmp(fileData.data() + offset, buffer.data().data(), length), 0);
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(mapped_buffer_unit_tests, move)
+{
+	const auto expectedData{writeTestFile(100)};
+
+	byte_buffer::MappedBuffer bufferOld(fileName);
+	byte_buffer::MappedBuffer bufferNew(std::move(bufferOld));
+
+	ASSERT_EQ(bufferOld.data().data(), nullptr);
+	ASSERT_TRUE(bufferOld.empty());
+
+	bufferOld = std::move(bufferNew);
+
+	ASSERT_TRUE(bufferNew.empty());
+	ASSERT_EQ(bufferOld.size(), expectedData.size());
+	ASSERT_EQ(std::memcmp(expectedData.data(), bufferOld.data().data(), expectedData.size()), 0);
+
+	std::filesystem::remove(fileName);
+}
+
+TEST(mapped_buffer_unit_tests, map_invalid_region)
+{
+	writeTestFile(100);
+
+	ASSERT_THROW(byte_buffer::MappedBuffer(fileName, 101), std::out_of_range);
+	ASSERT_THROW(byte_buffer::MappedBuffer(fileName, 50, 51), std::out_of_range);
+	ASSERT_TRUE(byte_buffer::MappedBuffer(fileName, 100).empty());
+
+	std::filesystem::remove(fileName);
+
+	ASSERT_THROW(byte_buffer::MappedBuffer{fileName}, std::system_error);
+}
+
+int main(int argc, char** argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,117 @@
+#include <cstdint>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "../include/byte_buffer/byte_buffer.hpp"
+#include "../include/byte_buffer/memory_resource.hpp"
+
+TEST(memory_resource_unit_tests, buffers_from_thread_arena)
+{
+	const std::vector<std::byte> someData(2 * byte_buffer::Buffer::inlineCapacity, std::byte{0x1});
+	const auto someDataSize{someData.size()};
+
+	{
+		byte_buffer::Buffer bufferFirst({someData.data(), someDataSize}, byte_buffer::thread_arena_resource());
+		byte_buffer::Buffer bufferSecond({someData.data(), someDataSize}, byte_buffer::thread_arena_resource());
+		bufferSecond.append({someData.data(), someDataSize});
+
+		ASSERT_EQ(std::memcmp(someData.data(), bufferFirst.data().data(), someDataSize), 0);
+		ASSERT_EQ(std::memcmp(someData.data(), bufferSecond.data().data() + someDataSize, someDataSize), 0);
+	}
+
+	byte_buffer::release_thread_arena();
+}
+
+TEST(memory_resource_unit_tests, thread_resources_are_per_thread)
+{
+	const auto arena{byte_buffer::thread_arena_resource()};
+	const auto pool{byte_buffer::thread_pool_resource()};
+
+	ASSERT_EQ(arena, byte_buffer::thread_arena_resource());
+	ASSERT_EQ(pool, byte_buffer::thread_pool_resource());
+
+	std::pmr::memory_resource* otherArena{};
+	std::pmr::memory_resource* otherPool{};
+
+	std::thread([&] {
+		otherArena = byte_buffer::thread_arena_resource();
+		otherPool = byte_buffer::thread_pool_resource();
+	}).join();
+
+	ASSERT_NE(arena, otherArena);
+	ASSERT_NE(pool, otherPool);
+}
+
+TEST(memory_resource_unit_tests, pool_reuses_freed_blocks)
+{
+	const std::vector<std::byte> someData(2 * byte_buffer::Buffer::inlineCapacity, std::byte{0x1});
+	const auto someDataSize{someData.size()};
+
+	const std::byte* firstData{};
+
+	{
+		const byte_buffer::Buffer buffer({someData.data(), someDataSize}, byte_buffer::thread_pool_resource());
+		firstData = buffer.data().data();
+	}
+
+	const byte_buffer::Buffer buffer({someData.data(), someDataSize}, byte_buffer::thread_pool_resource());
+
+	ASSERT_EQ(buffer.data().data(), firstData);
+	ASSERT_EQ(std::memcmp(someData.data(), buffer.data().data(), someDataSize), 0);
+}
+
+TEST(memory_resource_unit_tests, page_resource_alignment)
+{
+	byte_buffer::PageResource resource;
+	const std::vector<std::byte> someData(10000, std::byte{0x1});
+
+	byte_buffer::Buffer buffer({someData.data(), someData.size()}, &resource);
+
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data().data()) % 4096, 0);
+
+	buffer.set_alignment(2 << 20);
+	buffer.append({someData.data(), someData.size()});
+
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data().data()) % (2 << 20), 0);
+	ASSERT_EQ(std::memcmp(someData.data(), buffer.data().data() + someData.size(), someData.size()), 0);
+}
+
+TEST(memory_resource_unit_tests, page_resource_transparent_huge_pages)
+{
+	byte_buffer::PageResource resource({.hugePages = byte_buffer::HugePages::transparent});
+
+	byte_buffer::Buffer buffer(&resource);
+	buffer.reserve(3 << 20);
+
+	ASSERT_EQ(reinterpret_cast<std::uintptr_t>(buffer.data().data()) % byte_buffer::PageResource::hugePageSize, 0);
+
+	const auto window{buffer.prepare(3 << 20)};
+	std::memset(window.data(), 0x1, window.size());
+	buffer.commit(window.size());
+
+	ASSERT_EQ(buffer.size(), 3 << 20);
+}
+
+TEST(memory_resource_unit_tests, page_resource_numa_binding)
+{
+	byte_buffer::PageResource resource({.numaNode = 0});
+
+	try
+	{
+		byte_buffer::Buffer buffer(std::vector<std::byte>(10000, std::byte{0x1}), &resource);
+		ASSERT_EQ(buffer.size(), 10000);
+	}
+	catch (const std::system_error& error)
+	{
+		GTEST_SKIP() << "NUMA binding is not permitted: " << error.what();
+	}
+}
+
+int main(int argc, char** argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
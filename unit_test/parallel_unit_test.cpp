@@ -0,0 +1,115 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../include/byte_buffer/byte_buffer.hpp"
+#include "../include/byte_buffer/kernels.hpp"
+#include "../include/byte_buffer/parallel.hpp"
+
+namespace
+{
+constexpr std::size_t chunkSize{4096};
+
+std::vector<std::byte> testData(std::size_t size)
+{
+	std::vector<std::byte> data(size);
+
+	for (std::size_t i{}; i < size; ++i)
+	{
+		data[i] = std::byte(i * 7 + i / 251);
+	}
+
+	return data;
+}
+
+class parallel_unit_tests : public ::testing::TestWithParam<std::size_t>
+{
+};
+} // namespace
+
+TEST_P(parallel_unit_tests, copy)
+{
+	byte_buffer::ThreadPool pool(GetParam(), chunkSize);
+
+	ASSERT_EQ(pool.thread_count(), GetParam());
+
+	// sizes below, at and above the chunk size and a partial last chunk
+	for (const auto size : {0ul, 1ul, chunkSize, chunkSize * 37 + 5})
+	{
+		for (const auto nonTemporal : {false, true})
+		{
+			const auto source{testData(size)};
+			std::vector<std::byte> destination(size + 1, std::byte{0xee});
+			pool.copy(std::span(destination).subspan(1), source, nonTemporal);
+
+			ASSERT_EQ(destination[0], std::byte{0xee});
+			ASSERT_TRUE(std::equal(source.begin(), source.end(), destination.begin() + 1));
+		}
+	}
+}
+
+TEST_P(parallel_unit_tests, fill)
+{
+	byte_buffer::ThreadPool pool(GetParam(), chunkSize);
+
+	for (const auto nonTemporal : {false, true})
+	{
+		std::vector<std::byte> destination(chunkSize * 20 + 3);
+		pool.fill(destination, std::byte{0x5a}, nonTemporal);
+
+		ASSERT_EQ(std::count(destination.begin(), destination.end(), std::byte{0x5a}), destination.size());
+	}
+}
+
+TEST_P(parallel_unit_tests, crc32c_agrees_with_serial)
+{
+	byte_buffer::ThreadPool pool(GetParam(), chunkSize);
+
+	for (const auto size : {0ul, 100ul, chunkSize * 50 + 17})
+	{
+		const auto data{testData(size)};
+
+		ASSERT_EQ(pool.crc32c(data), byte_buffer::kernels::crc32c(data));
+		ASSERT_EQ(pool.crc32c(data, 0xdeadbeef), byte_buffer::kernels::crc32c(data, 0xdeadbeef));
+	}
+}
+
+TEST_P(parallel_unit_tests, repeated_operations)
+{
+	byte_buffer::ThreadPool pool(GetParam(), chunkSize);
+	const auto source{testData(chunkSize * 8)};
+
+	for (auto i{0}; i < 200; ++i)
+	{
+		std::vector<std::byte> destination(source.size());
+		pool.copy(destination, source);
+
+		ASSERT_EQ(destination, source);
+	}
+}
+
+INSTANTIATE_TEST_SUITE_P(thread_counts, parallel_unit_tests, ::testing::Values(1, 2, 3, 8));
+
+TEST(parallel_copy_policy_unit_tests, buffer_copies_above_threshold)
+{
+	ASSERT_EQ(byte_buffer::parallel_copy_policy().threshold, 0);
+
+	byte_buffer::set_parallel_copy_policy({1 << 20, true});
+
+	const auto someData{testData(5 << 20)};
+	const byte_buffer::Buffer buffer(someData);
+	auto copy{buffer};
+	copy.reserve(copy.size() * 2);
+
+	byte_buffer::set_parallel_copy_policy({});
+
+	ASSERT_EQ(byte_buffer::parallel_copy_policy().threshold, 0);
+	ASSERT_TRUE(std::equal(someData.begin(), someData.end(), buffer.data().begin()));
+	ASSERT_TRUE(std::equal(someData.begin(), someData.end(), copy.data().begin()));
+}
+
+int main(int argc, char** argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
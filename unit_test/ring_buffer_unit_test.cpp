@@ -0,0 +1,113 @@
+#include <cstring>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <unistd.h>
+#include <vector>
+
+#include "../include/byte_buffer/ring_buffer.hpp"
+
+TEST(ring_buffer_unit_tests, default_construct)
+{
+	byte_buffer::RingBuffer buffer;
+
+	ASSERT_EQ(buffer.capacity(), 0);
+	ASSERT_EQ(buffer.size(), 0);
+	ASSERT_TRUE(buffer.empty());
+	ASSERT_TRUE(buffer.readable().empty());
+	ASSERT_TRUE(buffer.writable().empty());
+}
+
+TEST(ring_buffer_unit_tests, capacity_is_page_rounded)
+{
+	const byte_buffer::RingBuffer buffer(1);
+
+	ASSERT_GE(buffer.capacity(), 1);
+	ASSERT_EQ(buffer.capacity() % ::sysconf(_SC_PAGESIZE), 0);
+}
+
+TEST(ring_buffer_unit_tests, write_commit_and_consume)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::RingBuffer buffer(4096);
+	const auto space{buffer.writable()};
+
+	ASSERT_EQ(space.size(), buffer.capacity());
+
+	std::memcpy(space.data(), someData, someDataSize);
+	buffer.commit(someDataSize);
+
+	ASSERT_EQ(buffer.size(), someDataSize);
+	ASSERT_EQ(std::memcmp(someData, buffer.readable().data(), someDataSize), 0);
+
+	buffer.consume(1);
+
+	ASSERT_EQ(buffer.size(), someDataSize - 1);
+	ASSERT_EQ(std::memcmp(someData + 1, buffer.readable().data(), someDataSize - 1), 0);
+	ASSERT_THROW(buffer.consume(someDataSize), std::out_of_range);
+	ASSERT_THROW(buffer.commit(buffer.capacity()), std::out_of_range);
+}
+
+TEST(ring_buffer_unit_tests, wrap_around_is_contiguous)
+{
+	byte_buffer::RingBuffer buffer(4096);
+	const auto capacity{buffer.capacity()};
+	const std::vector<std::byte> filler(capacity - 10, std::byte{0x0});
+
+	ASSERT_EQ(buffer.write(filler), filler.size());
+
+	buffer.consume(filler.size());
+
+	std::vector<std::byte> someData(100);
+
+	for (auto i{0u}; i < someData.size(); ++i)
+	{
+		someData[i] = std::byte(i);
+	}
+
+	ASSERT_EQ(buffer.write(someData), someData.size());
+	ASSERT_EQ(buffer.readable().size(), someData.size());
+	ASSERT_EQ(std::memcmp(someData.data(), buffer.readable().data(), someData.size()), 0);
+	ASSERT_EQ(buffer.writable().size(), capacity - someData.size());
+}
+
+TEST(ring_buffer_unit_tests, write_into_full_buffer)
+{
+	byte_buffer::RingBuffer buffer(4096);
+	const std::vector<std::byte> someData(buffer.capacity() + 1, std::byte{0x1});
+
+	ASSERT_EQ(buffer.write(someData), buffer.capacity());
+	ASSERT_EQ(buffer.write(someData), 0);
+	ASSERT_TRUE(buffer.writable().empty());
+
+	buffer.clear();
+
+	ASSERT_TRUE(buffer.empty());
+}
+
+TEST(ring_buffer_unit_tests, move)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::RingBuffer bufferOld(4096);
+	bufferOld.write({someData, someDataSize});
+
+	byte_buffer::RingBuffer bufferNew(std::move(bufferOld));
+
+	ASSERT_EQ(bufferOld.capacity(), 0);
+	ASSERT_TRUE(bufferOld.empty());
+	ASSERT_EQ(bufferNew.size(), someDataSize);
+	ASSERT_EQ(std::memcmp(someData, bufferNew.readable().data(), someDataSize), 0);
+
+	bufferOld = std::move(bufferNew);
+
+	ASSERT_EQ(bufferOld.size(), someDataSize);
+}
+
+int main(int argc, char** argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
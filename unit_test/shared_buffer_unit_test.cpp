@@ -0,0 +1,120 @@
+#include <cstring>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+#include "../include/byte_buffer/shared_buffer.hpp"
+
+TEST(shared_buffer_unit_tests, default_construct)
+{
+	const byte_buffer::SharedBuffer buffer;
+
+	ASSERT_EQ(buffer.data().data(), nullptr);
+	ASSERT_EQ(buffer.size(), 0);
+	ASSERT_TRUE(buffer.empty());
+	ASSERT_TRUE(buffer.unique());
+}
+
+TEST(shared_buffer_unit_tests, copy_shares_storage)
+{
+	constexpr std::byte expectedData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto expectedDataSize{std::size(expectedData)};
+
+	const byte_buffer::SharedBuffer bufferOld({expectedData, expectedDataSize});
+	const byte_buffer::SharedBuffer bufferNew(bufferOld);
+
+	ASSERT_EQ(bufferNew.data().data(), bufferOld.data().data());
+	ASSERT_EQ(bufferNew.size(), expectedDataSize);
+	ASSERT_FALSE(bufferOld.unique());
+	ASSERT_EQ(std::memcmp(expectedData, bufferNew.data().data(), expectedDataSize), 0);
+}
+
+TEST(shared_buffer_unit_tests, slice_keeps_parent_alive)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}, std::byte{0x4}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::SharedBuffer part;
+
+	{
+		const byte_buffer::SharedBuffer buffer(byte_buffer::Buffer({someData, someDataSize}));
+		part = buffer.slice(1, 2);
+
+		ASSERT_EQ(part.data().data(), buffer.data().data() + 1);
+		ASSERT_THROW((void)buffer.slice(3, 2), std::out_of_range);
+	}
+
+	ASSERT_TRUE(part.unique());
+	ASSERT_EQ(part.size(), 2);
+	ASSERT_EQ(std::memcmp(someData + 1, part.data().data(), 2), 0);
+}
+
+TEST(shared_buffer_unit_tests, append_copies_shared_storage)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	const byte_buffer::SharedBuffer bufferOld({someData, someDataSize});
+	byte_buffer::SharedBuffer bufferNew(bufferOld);
+	bufferNew.append({someData, someDataSize});
+
+	ASSERT_NE(bufferNew.data().data(), bufferOld.data().data());
+	ASSERT_TRUE(bufferOld.unique());
+	ASSERT_TRUE(bufferNew.unique());
+	ASSERT_EQ(bufferOld.size(), someDataSize);
+	ASSERT_EQ(bufferNew.size(), 2 * someDataSize);
+	ASSERT_EQ(std::memcmp(someData, bufferNew.data().data() + someDataSize, someDataSize), 0);
+}
+
+TEST(shared_buffer_unit_tests, append_to_unique_slice)
+{
+	constexpr std::byte someData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr auto someDataSize{std::size(someData)};
+
+	byte_buffer::SharedBuffer buffer({someData, someDataSize});
+	buffer = buffer.slice(0, 1);
+	buffer.append({someData + 2, 1});
+
+	ASSERT_EQ(buffer.size(), 2);
+	ASSERT_EQ(buffer.data()[0], someData[0]);
+	ASSERT_EQ(buffer.data()[1], someData[2]);
+}
+
+TEST(shared_buffer_unit_tests, append_own_data_of_unique_slice)
+{
+	std::byte someData[200];
+
+	for (std::size_t i{}; i < std::size(someData); ++i)
+	{
+		someData[i] = std::byte(i);
+	}
+
+	// the slice has an offset, so appending moves the data out of the storage the appended bytes point into
+	byte_buffer::SharedBuffer buffer({someData, std::size(someData)});
+	buffer = buffer.slice(10, 100);
+	buffer.append(buffer.data());
+
+	ASSERT_EQ(buffer.size(), 200);
+	ASSERT_EQ(std::memcmp(buffer.data().data(), someData + 10, 100), 0);
+	ASSERT_EQ(std::memcmp(buffer.data().data() + 100, someData + 10, 100), 0);
+}
+
+TEST(shared_buffer_unit_tests, overwrite_copies_shared_storage)
+{
+	constexpr std::byte oldData[]{std::byte{0x1}, std::byte{0x2}, std::byte{0x3}};
+	constexpr std::byte newData[]{std::byte{0x4}, std::byte{0x5}};
+
+	const byte_buffer::SharedBuffer bufferOld({oldData, std::size(oldData)});
+	byte_buffer::SharedBuffer bufferNew(bufferOld);
+	bufferNew.overwrite({newData, std::size(newData)});
+
+	ASSERT_EQ(bufferOld.size(), std::size(oldData));
+	ASSERT_EQ(std::memcmp(oldData, bufferOld.data().data(), std::size(oldData)), 0);
+	ASSERT_EQ(bufferNew.size(), std::size(newData));
+	ASSERT_EQ(std::memcmp(newData, bufferNew.data().data(), std::size(newData)), 0);
+}
+
+int main(int argc, char** argv)
+{
+	testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}
@@ -0,0 +1,98 @@
+#include <array>
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+#include "../include/byte_buffer/byte_buffer.hpp"
+#include "../include/byte_buffer/static_buffer.hpp"
+
+namespace
+{
+// writes a record header: 16-bit big endian type and 32-bit big endian length
+template <byte_buffer::BufferLike Buffer>
+constexpr void writeHeader(Buffer& buffer, uint16_t type, uint32_t length)
+{
+	const auto window{buffer.prepare(6)};
+	window[0] = std::byte(type >> 8);
+	window[1] = std::byte(type);
+
+	for (auto i{0}; i < 4; ++i)
+	{
+		window[2 + i] = std::byte(length >> (24 - 8 * i));
+	}
+
+	buffer.commit(6);
+}
+
+constexpr auto compileTimeHeader{[] {
+	byte_buffer::StaticBuffer<16> buffer;
+	writeHeader(buffer, 0x0102, 0x0a0b0c0d);
+
+	constexpr std::array trailer{std::byte{0xff}, std::byte{0xfe}};
+	buffer.append(trailer);
+
+	return buffer;
+}()};
+
+static_assert(compileTimeHeader.size() == 8);
+static_assert(compileTimeHeader.data()[0] == std::byte{0x01});
+static_assert(compileTimeHeader.data()[5] == std::byte{0x0d});
+static_assert(compileTimeHeader.data()[7] == std::byte{0xfe});
+static_assert(sizeof(byte_buffer::StaticBuffer<16>) == 17);
+static_assert(byte_buffer::StaticBuffer<16>::capacity() == 16);
+} // namespace
+
+TEST(static_buffer_unit_tests, compile_time_message)
+{
+	const std::array expected{std::byte{0x01}, std::byte{0x02}, std::byte{0x0a}, std::byte{0x0b}, std::byte{0x0c}, std::byte{0x0d},
+		std::byte{0xff}, std::byte{0xfe}};
+
+	ASSERT_TRUE(std::ranges::equal(compileTimeHeader.data(), expected));
+}
+
+TEST(static_buffer_unit_tests, generic_code_builds_the_same_data)
+{
+	byte_buffer::StaticBuffer<6> staticBuffer;
+	byte_buffer::Buffer buffer;
+
+	writeHeader(staticBuffer, 7, 1000);
+	writeHeader(buffer, 7, 1000);
+
+	ASSERT_TRUE(std::ranges::equal(staticBuffer.data(), buffer.data()));
+}
+
+TEST(static_buffer_unit_tests, overwrite_and_clear)
+{
+	const std::array someData{std::byte{1}, std::byte{2}, std::byte{3}};
+	byte_buffer::StaticBuffer<4> buffer(someData);
+	buffer.overwrite(std::span(someData).last(1));
+
+	ASSERT_EQ(buffer.size(), 1);
+	ASSERT_EQ(buffer.data()[0], std::byte{3});
+	ASSERT_EQ(buffer, byte_buffer::StaticBuffer<4>(std::span(someData).last(1)));
+
+	buffer.clear();
+
+	ASSERT_TRUE(buffer.empty());
+}
+
+TEST(static_buffer_unit_tests, capacity_is_never_exceeded)
+{
+	const std::array someData{std::byte{1}, std::byte{2}, std::byte{3}};
+	byte_buffer::StaticBuffer<4> buffer(someData);
+
+	ASSERT_THROW(buffer.append(someData), std::length_error);
+	ASSERT_THROW((void)buffer.prepare(2), std::length_error);
+	ASSERT_THROW(buffer.commit(2), std::out_of_range);
+	ASSERT_THROW(buffer.resize_uninitialized(5), std::length_error);
+	ASSERT_EQ(buffer.size(), someData.size());
+
+	buffer.append(std::span(someData).first(1));
+
+	ASSERT_EQ(buffer.size(), buffer.capacity());
+}
+
+int main(int argc, char** argv)
+{
+	::testing::InitGoogleTest(&argc, argv);
+	return RUN_ALL_TESTS();
+}